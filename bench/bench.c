@@ -0,0 +1,631 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * usage: huff_bench [--json] [build iterations] [decode repeats]
+ *
+ * huff_bench_wide is the same with HUFF_ENABLE_BIG_BITSTREAM (128-bit
+ * reservoir), compare both to see which refill width is faster on a machine.
+ *
+ * each result is printed on its own line, with --json as one JSON object
+ * per line: {"bench", "code", "variant", "metric", "value", "unit"}
+ */
+
+#include <huff/huff.h>
+#include <huff/deflate.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h>
+#  define BENCH_HAVE_TSC 1
+#elif defined(_M_X64) || defined(_M_IX86)
+#  include <intrin.h>
+#  define BENCH_HAVE_TSC 1
+#endif
+
+#define BENCH_SYMS  (1U << 18)
+#define BENCH_BYTES (BENCH_SYMS * (HUFF_MAX_CODE_LENGTH / 8) + 64)
+#define BENCH_ITEMS (BENCH_SYMS / 4)
+
+typedef struct bench_code_t {
+  const char *name;
+  uint8_t     lengths[HUFF_MAX_CODES];
+  uint16_t    n;
+} bench_code_t;
+
+typedef struct bench_stream_t {
+  uint16_t syms[BENCH_SYMS];
+  uint8_t  lsb[BENCH_BYTES];
+  uint8_t  msb[BENCH_BYTES];
+  size_t   lsb_size;
+  size_t   msb_size;
+} bench_stream_t;
+
+static int            bench_json;
+static bench_stream_t bench_stream;
+static uint16_t       bench_out[BENCH_SYMS];
+
+static double
+bench_now(void) {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static uint64_t
+bench_cycles(void) {
+#ifdef BENCH_HAVE_TSC
+  return (uint64_t)__rdtsc();
+#else
+  return 0;
+#endif
+}
+
+static void
+bench_report(const char *bench,
+             const char *code,
+             const char *variant,
+             const char *metric,
+             double      value,
+             const char *unit) {
+  if (bench_json) {
+    printf("{\"bench\":\"%s\",\"code\":\"%s\",\"variant\":\"%s\","
+           "\"metric\":\"%s\",\"value\":%.4f,\"unit\":\"%s\"}\n",
+           bench, code, variant, metric, value, unit);
+  } else {
+    printf("%-7s %-16s %-10s %-14s %12.3f %s\n",
+           bench, code, variant, metric, value, unit);
+  }
+}
+
+/* DEFLATE fixed lit/len code */
+static void
+bench_code_fixed(bench_code_t *code) {
+  int i;
+  for (i = 0;   i < 144; i++) code->lengths[i] = 8;
+  for (i = 144; i < 256; i++) code->lengths[i] = 9;
+  for (i = 256; i < 280; i++) code->lengths[i] = 7;
+  for (i = 280; i < 288; i++) code->lengths[i] = 8;
+  code->n    = 288;
+  code->name = "fixed_litlen";
+}
+
+/* lengths from a skewed distribution, like dynamic lit/len blocks of silesia */
+static void
+bench_code_dynamic(bench_code_t *code) {
+  uint32_t freqs[286];
+  uint32_t x = 12345;
+  int      i;
+
+  for (i = 0; i < 286; i++) {
+    x        = x * 1103515245U + 12345U;
+    freqs[i] = 1 + ((x >> 16) % (i < 128 ? 2000 : 40));
+  }
+
+  huff_build_lengths(freqs, 286, 15, code->lengths);
+  code->n    = 286;
+  code->name = "dynamic_litlen";
+}
+
+/* zipf distributed literals, like english text of canterbury */
+static void
+bench_code_text(bench_code_t *code) {
+  uint32_t freqs[256];
+  int      i;
+
+  for (i = 0; i < 256; i++)
+    freqs[i] = 100000U / (uint32_t)(i + 1);
+
+  huff_build_lengths(freqs, 256, 15, code->lengths);
+  code->n    = 256;
+  code->name = "text_zipf";
+}
+
+/* 19 symbol code length code */
+static void
+bench_code_precode(bench_code_t *code) {
+  static const uint8_t l[19] = {2,3,3,3,4,4,4,5,5,5,6,6,6,6,7,7,7,8,8};
+  memcpy(code->lengths, l, sizeof(l));
+  code->n    = 19;
+  code->name = "precode";
+}
+
+/* most codes 15-16 bits, worst case for sub tables */
+static void
+bench_code_long(bench_code_t *code) {
+  uint32_t freqs[HUFF_MAX_CODES];
+  int      i;
+
+  for (i = 0; i < HUFF_MAX_CODES; i++)
+    freqs[i] = i < 8 ? (1U << 20) : 1;
+
+  huff_build_lengths(freqs, HUFF_MAX_CODES, HUFF_MAX_CODE_LENGTH, code->lengths);
+  code->n    = HUFF_MAX_CODES;
+  code->name = "long";
+}
+
+/* only 15 and 16 bit codes, every symbol needs the sub table */
+static void
+bench_code_worst(bench_code_t *code) {
+  int i;
+  for (i = 0; i < HUFF_MAX_CODES; i++)
+    code->lengths[i] = i < 144 ? 15 : 16;
+  code->n    = HUFF_MAX_CODES;
+  code->name = "worst_15_16";
+}
+
+/* symbols are drawn with probability 2^-len, then written LSB and MSB first */
+static void
+bench_encode(const bench_code_t *code) {
+  bench_stream_t *s;
+  huff_writer_t   lsb, msb;
+  uint32_t        cum[HUFF_MAX_CODES + 1], x, r;
+  uint16_t        lcodes[HUFF_MAX_CODES], mcodes[HUFF_MAX_CODES];
+  unsigned        i, lo, hi, mid, len;
+
+  s = &bench_stream;
+  x = 777;
+
+  cum[0] = 0;
+  for (i = 0; i < code->n; i++) {
+    len      = code->lengths[i];
+    cum[i+1] = cum[i] + (len ? 1U << (HUFF_MAX_CODE_LENGTH - len) : 0);
+  }
+
+  huff_codes_lsb(code->lengths, code->n, lcodes);
+  huff_codes_msb(code->lengths, code->n, mcodes);
+
+  huff_writer_init(&lsb, s->lsb, s->lsb + sizeof(s->lsb));
+  huff_writer_init(&msb, s->msb, s->msb + sizeof(s->msb));
+
+  for (i = 0; i < BENCH_SYMS; i++) {
+    x  = x * 1103515245U + 12345U;
+    r  = ((x >> 8) & 0xFFFFFF) % cum[code->n];
+    lo = 0;
+    hi = code->n;
+
+    /* last symbol with cum <= r */
+    while (hi - lo > 1) {
+      mid = (lo + hi) >> 1;
+      if (cum[mid] <= r) lo = mid;
+      else               hi = mid;
+    }
+
+    s->syms[i] = (uint16_t)lo;
+    huff_writer_put_lsb(&lsb, lcodes[lo], code->lengths[lo]);
+    huff_writer_put_msb(&msb, mcodes[lo], code->lengths[lo]);
+    huff_writer_flush_lsb(&lsb);
+    huff_writer_flush_msb(&msb);
+  }
+
+  huff_writer_finish_lsb(&lsb);
+  huff_writer_finish_msb(&msb);
+
+  s->lsb_size = (size_t)(lsb.p - s->lsb);
+  s->msb_size = (size_t)(msb.p - s->msb);
+}
+
+/* huff_writer_put_lsb() + flush per code vs huff_encode_lsb_n() */
+static void
+bench_encode_speed(const bench_code_t *code, int reps) {
+  static uint8_t   out[BENCH_BYTES];
+  huff_enc_table_t enc;
+  huff_writer_t    w;
+  uint16_t         codes[HUFF_MAX_CODES];
+  const uint16_t  *syms;
+  double           t0, t, put, bulk;
+  size_t           i;
+  int              k;
+
+  syms = bench_stream.syms;
+  huff_codes_lsb(code->lengths, code->n, codes);
+  if (!huff_init_enc_lsb(&enc, code->lengths, code->n)) {
+    fprintf(stderr, "encode %s: init failed\n", code->name);
+    exit(EXIT_FAILURE);
+  }
+
+  put = bulk = 0;
+  for (k = 0; k < reps; k++) {
+    t0 = bench_now();
+    huff_writer_init(&w, out, out + sizeof(out));
+    for (i = 0; i < BENCH_SYMS; i++) {
+      huff_writer_put_lsb(&w, codes[syms[i]], code->lengths[syms[i]]);
+      huff_writer_flush_lsb(&w);
+    }
+    huff_writer_finish_lsb(&w);
+    t = bench_now() - t0;
+    if (!k || t < put) put = t;
+
+    t0 = bench_now();
+    huff_writer_init(&w, out, out + sizeof(out));
+    huff_encode_lsb_n(&enc, syms, BENCH_SYMS, &w);
+    huff_writer_finish_lsb(&w);
+    t = bench_now() - t0;
+    if (!k || t < bulk) bulk = t;
+  }
+
+  if ((size_t)(w.p - out) != bench_stream.lsb_size
+      || memcmp(out, bench_stream.lsb, bench_stream.lsb_size) != 0)
+    fprintf(stderr, "encode %s: mismatch\n", code->name);
+
+  bench_report("encode", code->name, "put",  "throughput",
+               BENCH_SYMS * 1e3 / put, "Msym/s");
+  bench_report("encode", code->name, "bulk", "throughput",
+               BENCH_SYMS * 1e3 / bulk, "Msym/s");
+}
+
+static uint64_t
+bench_load64be(const uint8_t *p) {
+  return ((uint64_t)p[0] << 56) | ((uint64_t)p[1] << 48)
+       | ((uint64_t)p[2] << 40) | ((uint64_t)p[3] << 32)
+       | ((uint64_t)p[4] << 24) | ((uint64_t)p[5] << 16)
+       | ((uint64_t)p[6] << 8)  |  (uint64_t)p[7];
+}
+
+typedef enum bench_variant_t {
+  BENCH_FN = 0,
+  BENCH_MACRO,
+  BENCH_BULK,
+  BENCH_MULTI,
+  BENCH_MSB,
+  BENCH_VARIANT_COUNT
+} bench_variant_t;
+
+static const char *bench_variant_names[BENCH_VARIANT_COUNT] = {
+  "fn", "macro", "bulk", "multi", "msb"
+};
+
+static size_t
+bench_decode_once(bench_variant_t           variant,
+                  const huff_table_t       *lsb,
+                  const huff_table_multi_t *multi,
+                  const huff_table_t       *msb) {
+  bench_stream_t *s;
+  huff_reader_t   r;
+  bitstream_t     w;
+  size_t          i, pos;
+  unsigned        j;
+  uint8_t         used;
+
+  s = &bench_stream;
+  huff_reader_init(&r, s->lsb, s->lsb + s->lsb_size);
+
+  switch (variant) {
+    case BENCH_FN:
+      for (i = 0; i < BENCH_SYMS; ) {
+        huff_reader_refill(&r);
+        for (j = 0; j < HUFF_SYMS_PER_REFILL && i < BENCH_SYMS; j++) {
+          bench_out[i++] = (uint16_t)huff_decode_lsb(lsb, r.bits, 0, &used);
+          huff_reader_consume(&r, used);
+        }
+      }
+      return i;
+    case BENCH_MACRO:
+      for (i = 0; i < BENCH_SYMS; ) {
+        huff_reader_refill(&r);
+        for (j = 0; j < HUFF_SYMS_PER_REFILL && i < BENCH_SYMS; j++) {
+          HUFF_DECODE_LSB(lsb, r.bits, 0, &used, bench_out[i]);
+          huff_reader_consume(&r, used);
+          i++;
+        }
+      }
+      return i;
+    case BENCH_BULK:
+      return huff_decode_lsb_n(lsb, &r, bench_out, BENCH_SYMS);
+    case BENCH_MULTI:
+      return huff_decode_lsb_multi_n(multi, &r, bench_out, BENCH_SYMS);
+    case BENCH_MSB:
+      for (i = pos = 0; i < BENCH_SYMS; i++) {
+        /* 64 bit window at the top of bitstream_t */
+        w = (bitstream_t)(bench_load64be(s->msb + (pos >> 3)) << (pos & 7));
+        bench_out[i] = (uint16_t)huff_decode_msb(msb,
+                                                 w << (HUFF_BITSTREAM_BITS - 64),
+                                                 0, &used);
+        pos += used;
+      }
+      return i;
+    default:
+      return 0;
+  }
+}
+
+static void
+bench_decode(const bench_code_t *code, int reps) {
+  static huff_table_t       lsb, msb;
+  static huff_table_multi_t multi;
+  bench_stream_t           *s;
+  double                    t0, t, best;
+  uint64_t                  c0, c, bestc;
+  size_t                    size;
+  int                       v, k;
+
+  s = &bench_stream;
+  bench_encode(code);
+
+  huff_init_lsb(&lsb, code->lengths, NULL, code->n);
+  huff_init_msb(&msb, code->lengths, NULL, code->n);
+  huff_init_lsb_multi(&multi, code->lengths, NULL, code->n, HUFF_MAX_CODES);
+
+  for (v = 0; v < BENCH_VARIANT_COUNT; v++) {
+    size = v == BENCH_MSB ? s->msb_size : s->lsb_size;
+    best = 0;
+    bestc = 0;
+
+    for (k = 0; k < reps; k++) {
+      t0 = bench_now();
+      c0 = bench_cycles();
+      if (bench_decode_once((bench_variant_t)v, &lsb, &multi, &msb) != BENCH_SYMS
+          || memcmp(bench_out, s->syms, sizeof(bench_out)) != 0) {
+        fprintf(stderr, "decode %s %s: mismatch\n",
+                code->name, bench_variant_names[v]);
+        exit(EXIT_FAILURE);
+      }
+      c = bench_cycles() - c0;
+      t = bench_now() - t0;
+      if (!k || t < best)  best  = t;
+      if (!k || c < bestc) bestc = c;
+    }
+
+    bench_report("decode", code->name, bench_variant_names[v],
+                 "throughput", (double)size * 1e3 / best, "MB/s");
+    bench_report("decode", code->name, bench_variant_names[v],
+                 "ns_per_sym", best / BENCH_SYMS, "ns");
+    if (bestc)
+      bench_report("decode", code->name, bench_variant_names[v],
+                   "syms_per_cycle", (double)BENCH_SYMS / (double)bestc,
+                   "syms/tsc");
+  }
+}
+
+/* fraction of symbols found in the fast table, sub tables and slow path */
+static void
+bench_paths(const bench_code_t *code) {
+  static huff_table_t lsb;
+  huff_fast_entry_t   fe;
+  huff_reader_t       r;
+  size_t              i, fast, sub, slow;
+  uint8_t             used, fb;
+
+  huff_init_lsb(&lsb, code->lengths, NULL, code->n);
+  huff_reader_init(&r, bench_stream.lsb, bench_stream.lsb + bench_stream.lsb_size);
+
+  fb   = lsb.bits;
+  fast = sub = slow = 0;
+  for (i = 0; i < BENCH_SYMS; i++) {
+    huff_reader_refill(&r);
+    fe = lsb.fast[(uint_fast16_t)r.bits & ((1U << fb) - 1)];
+    if (fe.len) {
+      fast++;
+    } else if (fe.sub && lsb.fast[fe.sym + ((uint_fast16_t)(r.bits >> fb)
+                                            & ((1U << fe.sub) - 1))].len) {
+      sub++;
+    } else {
+      slow++;
+    }
+    huff_decode_lsb(&lsb, r.bits, 0, &used);
+    huff_reader_consume(&r, used);
+  }
+
+  bench_report("paths", code->name, "lsb", "fast",
+               100.0 * (double)fast / BENCH_SYMS, "%");
+  bench_report("paths", code->name, "lsb", "sub",
+               100.0 * (double)sub / BENCH_SYMS, "%");
+  bench_report("paths", code->name, "lsb", "slow",
+               100.0 * (double)slow / BENCH_SYMS, "%");
+}
+
+static void
+bench_build(const bench_code_t *code, int iters) {
+  static huff_table_t     table;
+  static huff_table_ext_t ext;
+  static huff_ext_t       extras[HUFF_MAX_CODES];
+  double                  t0, lsb, msb, xof;
+  int                     i;
+
+  for (i = 0; i < HUFF_MAX_CODES; i++) {
+    extras[i].base = (uint64_t)i;
+    extras[i].bits = (uint64_t)(i & 3);
+    extras[i].mask = (uint64_t)((1U << (i & 3)) - 1);
+  }
+
+  t0 = bench_now();
+  for (i = 0; i < iters; i++)
+    huff_init_lsb(&table, code->lengths, NULL, code->n);
+  lsb = (bench_now() - t0) / iters;
+
+  t0 = bench_now();
+  for (i = 0; i < iters; i++)
+    huff_init_msb(&table, code->lengths, NULL, code->n);
+  msb = (bench_now() - t0) / iters;
+
+  t0 = bench_now();
+  for (i = 0; i < iters; i++)
+    huff_init_lsb_extof(&ext, code->lengths, NULL, extras, 0, code->n);
+  xof = (bench_now() - t0) / iters;
+
+  bench_report("build", code->name, "lsb",       "latency", lsb, "ns");
+  bench_report("build", code->name, "msb",       "latency", msb, "ns");
+  bench_report("build", code->name, "lsb_extof", "latency", xof, "ns");
+}
+
+/* raw throughput of huff_read_* variants over the same buffer */
+static void
+bench_read(int reps) {
+  typedef int (*bench_read_fn)(const uint8_t **, bitstream_t *, const uint8_t *);
+  static const struct { const char *name; bench_read_fn fn; } reads[] = {
+    { "scalar", huff_read_scalar },
+#if defined(__ARM_NEON)
+    { "neon",   huff_read_neon   },
+#elif defined(__x86_64__) || defined(_M_X64)
+    { "sse",    huff_read_sse    },
+#  ifdef __AVX2__
+    { "avx2",   huff_read_avx2   },
+#  endif
+#endif
+  };
+  const uint8_t *p, *end;
+  bitstream_t    bits, acc;
+  double         t0, t, best;
+  size_t         v;
+  int            k;
+
+  end = bench_stream.lsb + bench_stream.lsb_size;
+  acc = 0;
+
+  for (v = 0; v < sizeof(reads) / sizeof(reads[0]); v++) {
+    best = 0;
+    for (k = 0; k < reps; k++) {
+      p  = bench_stream.lsb;
+      t0 = bench_now();
+      while (p < end) {
+        reads[v].fn(&p, &bits, end);
+        acc ^= bits;
+      }
+      t = bench_now() - t0;
+      if (!k || t < best) best = t;
+    }
+
+    bench_report("read", "worst_15_16", reads[v].name, "throughput",
+                 (double)bench_stream.lsb_size * 1e3 / best, "MB/s");
+  }
+
+  /* keep the loops */
+  if (acc == (bitstream_t)1)
+    fputc(' ', stderr);
+}
+
+/* huff_decode_match_lsb() over a fixed DEFLATE block, half of items are
+   matches with random extra bits */
+static void
+bench_match(int reps) {
+  static uint8_t  in[BENCH_ITEMS * (HUFF_MATCH_BITS / 8) + 64];
+  static uint32_t items[BENCH_ITEMS], out[BENCH_ITEMS];
+  bench_code_t    code;
+  huff_writer_t   w;
+  huff_reader_t   r;
+  huff_ext_t      e;
+  uint16_t        lcodes[HUFF_MAX_CODES], dcodes[30];
+  uint8_t         dlengths[30];
+  uint32_t        x, v, len;
+  unsigned        lit_or_len, dist;
+  uint_fast16_t   sym;
+  double          t0, t, best;
+  size_t          i, size;
+  int             k;
+
+  bench_code_fixed(&code);
+  memset(dlengths, 5, sizeof(dlengths));
+  huff_codes_lsb(code.lengths, code.n, lcodes);
+  huff_codes_lsb(dlengths, 30, dcodes);
+
+  huff_writer_init(&w, in, in + sizeof(in));
+  for (i = 0, x = 4242; i < BENCH_ITEMS; i++) {
+    x   = x * 1103515245U + 12345U;
+    sym = (x >> 31) ? (x >> 8) & 0xFF : 257 + (x >> 8) % 29;
+    huff_writer_put_lsb(&w, lcodes[sym], code.lengths[sym]);
+    items[i] = (uint32_t)sym;
+
+    if (sym > 256) {
+      e   = huff_deflate_len_extras[sym - 257];
+      v   = (x >> 16) & e.mask;
+      len = e.base + v;
+      huff_writer_put_lsb(&w, v, e.bits);
+
+      x   = x * 1103515245U + 12345U;
+      sym = (x >> 8) % 30;
+      e   = huff_deflate_dist_extras[sym];
+      v   = (x >> 16) & e.mask;
+      huff_writer_put_lsb(&w, dcodes[sym], dlengths[sym]);
+      huff_writer_put_lsb(&w, v, e.bits);
+      items[i] = len << 16 | (uint32_t)(e.base + v);
+    }
+    huff_writer_flush_lsb(&w);
+  }
+  huff_writer_finish_lsb(&w);
+  size = (size_t)(w.p - in);
+
+  best = 0;
+  dist = 0;
+  for (k = 0; k < reps; k++) {
+    huff_reader_init(&r, in, in + size);
+    t0 = bench_now();
+    for (i = 0; i < BENCH_ITEMS; i++) {
+      sym = huff_decode_match_lsb(&huff_deflate_fixed_litlen,
+                                  &huff_deflate_fixed_dist,
+                                  &r, &lit_or_len, &dist);
+      if (unlikely(sym > 285))
+        break;
+      out[i] = sym < 256 ? (uint32_t)sym : lit_or_len << 16 | dist;
+    }
+    t = bench_now() - t0;
+    if (!k || t < best) best = t;
+
+    if (i != BENCH_ITEMS || memcmp(out, items, sizeof(items)) != 0) {
+      fprintf(stderr, "match: mismatch\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  bench_report("match", "fixed_deflate", "fused", "throughput",
+               (double)size * 1e3 / best, "MB/s");
+  bench_report("match", "fixed_deflate", "fused", "ns_per_item",
+               best / BENCH_ITEMS, "ns");
+}
+
+int
+main(int argc, char *argv[]) {
+  static void (*codes[])(bench_code_t *) = {
+    bench_code_fixed, bench_code_dynamic, bench_code_text,
+    bench_code_precode, bench_code_long, bench_code_worst
+  };
+  bench_code_t code;
+  size_t       i;
+  int          iters, reps, a;
+
+  iters = 100000;
+  reps  = 5;
+  a     = 1;
+
+  if (a < argc && strcmp(argv[a], "--json") == 0) {
+    bench_json = 1;
+    a++;
+  }
+
+  if (a < argc) iters = atoi(argv[a++]);
+  if (a < argc) reps  = atoi(argv[a++]);
+  if (iters < 1) iters = 1;
+  if (reps  < 1) reps  = 1;
+
+  /* 64 or 128 (HUFF_ENABLE_BIG_BITSTREAM) */
+  bench_report("config", "reservoir", "bitstream", "width",
+               HUFF_BITSTREAM_BITS, "bits");
+
+  for (i = 0; i < sizeof(codes) / sizeof(codes[0]); i++) {
+    codes[i](&code);
+    bench_build(&code, iters);
+    bench_decode(&code, reps);
+    bench_encode_speed(&code, reps);
+    bench_paths(&code);
+  }
+
+  /* stream of the last code, longest input */
+  bench_read(reps);
+  bench_match(reps);
+
+  return 0;
+}
@@ -0,0 +1,394 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * usage: huff_bench_jpeg [--json] [decode repeats]
+ *
+ * checks huff/jpeg.h against libjpeg: images are encoded by libjpeg, their
+ * scans are decoded by huff_jpeg_decode_block() and coefficients are compared
+ * to jpeg_read_coefficients(), which is timed too. exits with failure on a
+ * mismatch. jpeg_read_coefficients() also fills its coefficient buffers, so
+ * the ratio is a little in favor of huff. only Release builds give a useful
+ * ratio, libjpeg is prebuilt with optimization.
+ *
+ * each result is printed on its own line, with --json as one JSON object
+ * per line: {"bench", "code", "variant", "metric", "value", "unit"}
+ */
+
+#include <huff/huff.h>
+#include <huff/jpeg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <jpeglib.h>
+
+typedef struct bench_image_t {
+  const char *name;
+  int         width;
+  int         height;
+  int         ncomp;
+  int         hsamp;   /* luma sampling, 2x2: 4:2:0                          */
+  int         vsamp;
+  int         quality;
+  int         optimize;
+  int         restart; /* restart interval in MCUs                          */
+} bench_image_t;
+
+typedef struct bench_scan_t {
+  huff_jpeg_table_t dc[4];
+  huff_jpeg_table_t ac[4];
+  const uint8_t    *p;
+  const uint8_t    *end;
+  int               restart;
+} bench_scan_t;
+
+static int bench_json;
+
+static double
+bench_now(void) {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void
+bench_report(const char *bench,
+             const char *code,
+             const char *variant,
+             const char *metric,
+             double      value,
+             const char *unit) {
+  if (bench_json) {
+    printf("{\"bench\":\"%s\",\"code\":\"%s\",\"variant\":\"%s\","
+           "\"metric\":\"%s\",\"value\":%.4f,\"unit\":\"%s\"}\n",
+           bench, code, variant, metric, value, unit);
+  } else {
+    printf("%-7s %-16s %-10s %-14s %12.3f %s\n",
+           bench, code, variant, metric, value, unit);
+  }
+}
+
+static void
+bench_fail(const char *name, const char *what) {
+  fprintf(stderr, "jpeg %s: %s\n", name, what);
+  exit(EXIT_FAILURE);
+}
+
+/* gradient with noise, more noise for higher quality to get long codes */
+static unsigned char*
+bench_encode(const bench_image_t *img, unsigned long *size) {
+  struct jpeg_compress_struct c;
+  struct jpeg_error_mgr       e;
+  unsigned char              *out, *row;
+  JSAMPROW                    rows[1];
+  uint32_t                    x;
+  int                         i, y, noise;
+
+  out = NULL;
+  row = malloc((size_t)img->width * img->ncomp);
+  if (!row)
+    bench_fail(img->name, "out of memory");
+
+  c.err = jpeg_std_error(&e);
+  jpeg_create_compress(&c);
+  jpeg_mem_dest(&c, &out, size);
+
+  c.image_width      = (JDIMENSION)img->width;
+  c.image_height     = (JDIMENSION)img->height;
+  c.input_components = img->ncomp;
+  c.in_color_space   = img->ncomp == 1 ? JCS_GRAYSCALE : JCS_RGB;
+
+  jpeg_set_defaults(&c);
+  jpeg_set_quality(&c, img->quality, TRUE);
+  c.optimize_coding  = img->optimize;
+  c.restart_interval = (unsigned)img->restart;
+  c.comp_info[0].h_samp_factor = img->hsamp;
+  c.comp_info[0].v_samp_factor = img->vsamp;
+
+  jpeg_start_compress(&c, TRUE);
+
+  noise = img->quality > 90 ? 96 : 32;
+  for (x = 4242; c.next_scanline < c.image_height;) {
+    y = (int)c.next_scanline;
+    for (i = 0; i < img->width * img->ncomp; i++) {
+      x      = x * 1103515245U + 12345U;
+      row[i] = (unsigned char)((i / img->ncomp) * 255 / img->width
+                               + y * 128 / img->height
+                               + (i % img->ncomp) * 40
+                               + (int)((x >> 16) % (uint32_t)noise));
+    }
+    rows[0] = row;
+    jpeg_write_scanlines(&c, rows, 1);
+  }
+
+  jpeg_finish_compress(&c);
+  jpeg_destroy_compress(&c);
+  free(row);
+  return out;
+}
+
+/* DHT, DRI and SOS up to the first scan, baseline files of bench_encode() */
+static void
+bench_parse(const bench_image_t *img,
+            const uint8_t       *jpeg,
+            size_t               size,
+            bench_scan_t        *scan) {
+  const uint8_t *p, *q, *end;
+  unsigned       len, tc, th, i, n;
+
+  p   = jpeg + 2;
+  end = jpeg + size;
+  scan->restart = 0;
+
+  while (end - p >= 4 && p[0] == 0xFF) {
+    len = (unsigned)p[2] << 8 | p[3];
+
+    if (p[1] == 0xC4) {
+      for (q = p + 4; q < p + 2 + len; q += 17 + n) {
+        tc = q[0] >> 4;
+        th = q[0] & 3;
+        for (i = 0, n = 0; i < 16; i++)
+          n += q[1 + i];
+
+        if (!huff_jpeg_init(tc ? &scan->ac[th] : &scan->dc[th], q + 1, q + 17))
+          bench_fail(img->name, "invalid DHT");
+      }
+    } else if (p[1] == 0xDD) {
+      scan->restart = p[4] << 8 | p[5];
+    } else if (p[1] == 0xDA) {
+      scan->p   = p + 2 + len;
+      scan->end = end;
+      return;
+    }
+
+    p += 2 + len;
+  }
+
+  bench_fail(img->name, "no scan");
+}
+
+/* huff decode of the scan into per component block arrays */
+static void
+bench_decode_scan(const bench_image_t                 *img,
+                  const bench_scan_t                  *scan,
+                  const struct jpeg_decompress_struct *d,
+                  int16_t                            **coef) {
+  const jpeg_component_info *ci;
+  huff_jpeg_reader_t         r;
+  int                        pred[MAX_COMPS_IN_SCAN];
+  int                        c, h, v, mx, my, mcux, mcuy, bx, by, w, mcu, one;
+
+  huff_jpeg_reader_init(&r, scan->p, scan->end);
+  memset(pred, 0, sizeof(pred));
+
+  /* a scan of one component is not interleaved, its MCU is one block */
+  one  = d->comps_in_scan == 1;
+  mcux = one ? (int)d->comp_info[0].width_in_blocks
+             : (img->width  + 8 * d->max_h_samp_factor - 1)
+               / (8 * d->max_h_samp_factor);
+  mcuy = one ? (int)d->comp_info[0].height_in_blocks
+             : (img->height + 8 * d->max_v_samp_factor - 1)
+               / (8 * d->max_v_samp_factor);
+
+  for (my = 0, mcu = 0; my < mcuy; my++) {
+    for (mx = 0; mx < mcux; mx++, mcu++) {
+      if (scan->restart && mcu && mcu % scan->restart == 0) {
+        if (!huff_jpeg_restart(&r))
+          bench_fail(img->name, "missing restart marker");
+        memset(pred, 0, sizeof(pred));
+      }
+
+      for (c = 0; c < d->comps_in_scan; c++) {
+        ci = d->cur_comp_info[c];
+        w  = (int)(ci->width_in_blocks + ci->h_samp_factor - 1)
+             / ci->h_samp_factor * ci->h_samp_factor;
+
+        for (v = 0; v < (one ? 1 : ci->v_samp_factor); v++) {
+          for (h = 0; h < (one ? 1 : ci->h_samp_factor); h++) {
+            bx = one ? mx : mx * ci->h_samp_factor + h;
+            by = one ? my : my * ci->v_samp_factor + v;
+
+            if (!huff_jpeg_decode_block(&scan->dc[ci->dc_tbl_no],
+                                        &scan->ac[ci->ac_tbl_no], &r, &pred[c],
+                                        coef[ci->component_index]
+                                          + 64 * ((size_t)by * w + bx)))
+              bench_fail(img->name, "invalid block");
+          }
+        }
+      }
+    }
+  }
+
+  if (huff_jpeg_reader_status(&r) != HUFF_OK)
+    bench_fail(img->name, "reader error");
+
+  /* scan ends at EOI */
+  huff_jpeg_restart(&r);
+  if (r.marker != 0xD9)
+    bench_fail(img->name, "scan does not end at EOI");
+}
+
+static void
+bench_image(const bench_image_t *img, int reps) {
+  struct jpeg_decompress_struct d;
+  struct jpeg_error_mgr         e;
+  static bench_scan_t           scan;
+  jvirt_barray_ptr             *arrays;
+  jpeg_component_info          *ci;
+  JBLOCKARRAY                   rows;
+  int16_t                      *coef[MAX_COMPONENTS];
+  unsigned char                *jpeg;
+  unsigned long                 size;
+  double                        t0, t, best, ref;
+  size_t                        blocks;
+  JDIMENSION                    bx, by, w, hb;
+  int                           c, k;
+
+  jpeg = bench_encode(img, &size);
+  bench_parse(img, jpeg, size, &scan);
+
+  best = ref = 0;
+  blocks = 0;
+  for (k = 0; k < reps; k++) {
+    d.err = jpeg_std_error(&e);
+    jpeg_create_decompress(&d);
+    jpeg_mem_src(&d, jpeg, size);
+    jpeg_read_header(&d, TRUE);
+
+    if (!k) {
+      for (c = 0; c < d.num_components; c++) {
+        ci      = &d.comp_info[c];
+        w       = (ci->width_in_blocks  + ci->h_samp_factor - 1)
+                  / ci->h_samp_factor * ci->h_samp_factor;
+        hb      = (ci->height_in_blocks + ci->v_samp_factor - 1)
+                  / ci->v_samp_factor * ci->v_samp_factor;
+        coef[c] = calloc((size_t)w * hb, 64 * sizeof(int16_t));
+        if (!coef[c])
+          bench_fail(img->name, "out of memory");
+      }
+    }
+
+    t0 = bench_now();
+    bench_decode_scan(img, &scan, &d, coef);
+    t  = bench_now() - t0;
+    if (!k || t < best) best = t;
+
+    t0     = bench_now();
+    arrays = jpeg_read_coefficients(&d);
+    t      = bench_now() - t0;
+    if (!k || t < ref) ref = t;
+
+    /* compare once, only blocks inside the image */
+    if (k == reps - 1) {
+      for (c = 0, blocks = 0; c < d.num_components; c++) {
+        ci = &d.comp_info[c];
+        w  = (ci->width_in_blocks + ci->h_samp_factor - 1)
+             / ci->h_samp_factor * ci->h_samp_factor;
+
+        for (by = 0; by < ci->height_in_blocks; by++) {
+          rows = d.mem->access_virt_barray((j_common_ptr)&d, arrays[c],
+                                           by, 1, FALSE);
+          for (bx = 0; bx < ci->width_in_blocks; bx++, blocks++) {
+            if (memcmp(rows[0][bx], coef[c] + 64 * ((size_t)by * w + bx),
+                       64 * sizeof(int16_t)) != 0)
+              bench_fail(img->name, "coefficient mismatch");
+          }
+        }
+      }
+
+      for (c = 0; c < d.num_components; c++)
+        free(coef[c]);
+    }
+
+    jpeg_destroy_decompress(&d);
+  }
+
+  free(jpeg);
+
+  bench_report("jpeg", img->name, "huff",    "throughput",
+               blocks / best * 1e3, "Mblock/s");
+  bench_report("jpeg", img->name, "libjpeg", "throughput",
+               blocks / ref  * 1e3, "Mblock/s");
+  bench_report("jpeg", img->name, "huff",    "time ratio",
+               best / ref, "x libjpeg");
+}
+
+/* random scans: decoding must stop with an error, never read past end */
+static void
+bench_garbage(void) {
+  static huff_jpeg_table_t dc, ac;
+  static uint8_t           in[512];
+  huff_jpeg_reader_t       r;
+  int16_t                  coef[64];
+  uint32_t                 x;
+  int                      i, k, n, pred, errors;
+
+  huff_jpeg_init(&dc, huff_jpeg_dc_luma_counts, huff_jpeg_dc_syms);
+  huff_jpeg_init(&ac, huff_jpeg_ac_luma_counts, huff_jpeg_ac_luma_syms);
+
+  for (i = 0, errors = 0, x = 4242; i < 10000; i++) {
+    n = i % (int)sizeof(in);
+    for (k = 0; k < n; k++) {
+      x     = x * 1103515245U + 12345U;
+      in[k] = ((x >> 8) & 7) ? (uint8_t)(x >> 24) : 0xFF;
+    }
+
+    huff_jpeg_reader_init(&r, in, in + n);
+    for (k = 0, pred = 0; k < 256; k++) {
+      if (!huff_jpeg_decode_block(&dc, &ac, &r, &pred, coef)
+          || huff_jpeg_reader_status(&r) != HUFF_OK)
+        break;
+    }
+
+    if (r.p > in + n)
+      bench_fail("garbage", "read past end");
+    errors += k < 256;
+  }
+
+  bench_report("jpeg", "garbage", "huff", "rejected", errors / 100.0, "%");
+}
+
+int
+main(int argc, char *argv[]) {
+  static const bench_image_t images[] = {
+    {"gray-q75",      512,  512, 1, 1, 1,  75, 0, 0},
+    {"420-q90",      1024,  768, 3, 2, 2,  90, 0, 0},
+    {"420-q90-opt",  1000,  750, 3, 2, 2,  90, 1, 8},
+    {"422-q85-rst3",  640,  480, 3, 2, 1,  85, 0, 3},
+    {"444-q98-opt",   320,  240, 3, 1, 1,  98, 1, 7},
+    {"444-q100-rst1", 200,  136, 3, 1, 1, 100, 1, 1}
+  };
+  size_t i;
+  int    reps, a;
+
+  reps = 5;
+  a    = 1;
+
+  if (a < argc && strcmp(argv[a], "--json") == 0) {
+    bench_json = 1;
+    a++;
+  }
+
+  if (a < argc) reps = atoi(argv[a++]);
+  if (reps < 1) reps = 1;
+
+  for (i = 0; i < sizeof(images) / sizeof(images[0]); i++)
+    bench_image(&images[i], reps);
+
+  bench_garbage();
+  return 0;
+}
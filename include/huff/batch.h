@@ -0,0 +1,414 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+/*
+ * batch decoder for many small independent records (HPACK strings, column
+ * pages ...). per call setup dominates such records, AVX2 / AVX-512 paths
+ * decode 16 records at a time, one record per lane: input windows and fast
+ * table entries are gathered and a lane takes the next record as soon as its
+ * record is done. without AVX2 records are decoded one by one.
+ */
+
+#ifndef huff_batch_h
+#define huff_batch_h
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct huff_record_t {
+  const huff_table_t *table;    /* LSB-first table, can differ per record  */
+  const uint8_t      *in;
+  size_t              in_len;
+  uint16_t           *out;
+  size_t              count;    /* max number of symbols to decode         */
+  size_t              decoded;  /* out: number of decoded symbols          */
+  unsigned            err;      /* out: HUFF_OK or HUFF_ERR_CODE           */
+} huff_record_t;
+
+/* decodes a record from bit `bit` on, as huff_decode_lsb_n() does */
+HUFF_INLINE
+void
+huff_batch_finish(huff_record_t * __restrict rec, size_t bit) {
+  huff_reader_t r;
+
+  huff_reader_seek(&r, rec->in, rec->in + rec->in_len, bit);
+  rec->decoded += huff_decode_lsb_n(rec->table, &r, rec->out + rec->decoded,
+                                    rec->count - rec->decoded);
+  rec->err      = r.err;
+}
+
+#if defined(__AVX2__)
+
+#define HUFF_BATCH_LANES  16
+#define HUFF_BATCH_STEPS  6 /* max codes per gathered window */
+
+/*
+ * lane state, 64 bit per lane. addresses are absolute, in bits for input.
+ * records shorter than 8 bytes are copied to zero padded pad, so windows of
+ * all lanes are loaded with one gather without reading past input.
+ */
+typedef struct huff_batch_lanes_t {
+  HUFF_ALIGN(64) uint64_t bitp[HUFF_BATCH_LANES];  /* next code             */
+  HUFF_ALIGN(64) uint64_t endp[HUFF_BATCH_LANES];  /* end of input          */
+  HUFF_ALIGN(64) uint64_t lim[HUFF_BATCH_LANES];   /* last 8 byte load      */
+  HUFF_ALIGN(64) uint64_t fast[HUFF_BATCH_LANES];  /* table->fast           */
+  HUFF_ALIGN(64) uint64_t mask[HUFF_BATCH_LANES];  /* fast table mask       */
+  HUFF_ALIGN(64) uint64_t bits[HUFF_BATCH_LANES];  /* fast table bits       */
+  HUFF_ALIGN(64) uint64_t rem[HUFF_BATCH_LANES];   /* symbols left          */
+  HUFF_ALIGN(64) uint64_t win[HUFF_BATCH_LANES];   /* window at bitp        */
+  HUFF_ALIGN(64) uint64_t wbits[HUFF_BATCH_LANES]; /* bits left in window   */
+  HUFF_ALIGN(64) uint64_t cnt[HUFF_BATCH_LANES];   /* decoded in round      */
+  HUFF_ALIGN(64) uint64_t done[HUFF_BATCH_LANES];  /* input ended or len 0  */
+  HUFF_ALIGN(64) uint64_t bad[HUFF_BATCH_LANES];   /* stopped at len 0 entry */
+  HUFF_ALIGN(64) uint64_t sym[HUFF_BATCH_STEPS][HUFF_BATCH_LANES];
+  const uint8_t          *base[HUFF_BATCH_LANES];  /* input or pad          */
+  uint8_t                 pad[HUFF_BATCH_LANES][16]; /* records < 8 bytes   */
+} huff_batch_lanes_t;
+
+/* entries at absolute addresses, gathers use a NULL base */
+HUFF_INLINE
+__m256i
+huff_batch_gather_avx2(__m256i fast, __m256i idx) {
+  __m256i addr;
+
+  addr = _mm256_add_epi64(fast, _mm256_slli_epi64(idx, 2));
+  return _mm256_cvtepu32_epi64(_mm256_i64gather_epi32((const int *)0, addr, 1));
+}
+
+#define HUFF_BATCH_LOAD(name)  _mm256_load_si256((const __m256i *)(L->name + q))
+#define HUFF_BATCH_STORE(name, v)                                              \
+  _mm256_store_si256((__m256i *)(L->name + q), v)
+
+/* loads windows of 8 bytes of lanes `q..q+3`, from lim near end of input */
+HUFF_INLINE
+void
+huff_batch_window_avx2(huff_batch_lanes_t * __restrict L, unsigned q) {
+  __m256i bitp, lim, addr, sh, w;
+
+  bitp = HUFF_BATCH_LOAD(bitp);
+  lim  = HUFF_BATCH_LOAD(lim);
+  addr = _mm256_srli_epi64(bitp, 3);
+  addr = _mm256_blendv_epi8(addr, lim, _mm256_cmpgt_epi64(addr, lim));
+  sh   = _mm256_sub_epi64(bitp, _mm256_slli_epi64(addr, 3));
+  w    = _mm256_i64gather_epi64((const long long *)0, addr, 1);
+
+  HUFF_BATCH_STORE(win,   _mm256_srlv_epi64(w, sh));
+  HUFF_BATCH_STORE(wbits, _mm256_sub_epi64(_mm256_set1_epi64x(64), sh));
+  HUFF_BATCH_STORE(cnt,   _mm256_setzero_si256());
+  HUFF_BATCH_STORE(done,  _mm256_setzero_si256());
+  HUFF_BATCH_STORE(bad,   _mm256_setzero_si256());
+}
+
+/*
+ * decodes a symbol in lanes `q..q+3` from their windows. a code which is not
+ * in the window stops the lane until next window, unless the window reaches
+ * to the end of input. bits after end of input are zero in windows as the
+ * zero padding of huff_decode_lsb_n().
+ */
+HUFF_INLINE
+void
+huff_batch_step_avx2(huff_batch_lanes_t * __restrict L, unsigned q, unsigned s) {
+  const __m256i zero = _mm256_setzero_si256(),
+                one  = _mm256_set1_epi64x(1),
+                ff   = _mm256_set1_epi64x(0xff);
+  __m256i fast, w, wb, rem, act, e, e2, len, link, sub, idx, ok, d, avail;
+  __m256i full, nul, done;
+
+  fast  = HUFF_BATCH_LOAD(fast);
+  w     = HUFF_BATCH_LOAD(win);
+  wb    = HUFF_BATCH_LOAD(wbits);
+  rem   = HUFF_BATCH_LOAD(rem);
+  avail = _mm256_sub_epi64(HUFF_BATCH_LOAD(endp), HUFF_BATCH_LOAD(bitp));
+  act   = _mm256_and_si256(_mm256_cmpgt_epi64(rem, zero),
+                           _mm256_cmpeq_epi64(HUFF_BATCH_LOAD(cnt),
+                                              _mm256_set1_epi64x(s)));
+
+  e   = huff_batch_gather_avx2(fast, _mm256_and_si256(w, HUFF_BATCH_LOAD(mask)));
+  len = _mm256_and_si256(e, ff);
+
+  /* sub table links, index of other lanes is zeroed to stay in table */
+  link = _mm256_and_si256(act, _mm256_cmpeq_epi64(len, zero));
+  if (unlikely(!_mm256_testz_si256(link, link))) {
+    sub  = _mm256_and_si256(_mm256_srli_epi64(e, 8), ff);
+    link = _mm256_andnot_si256(_mm256_cmpeq_epi64(sub, zero), link);
+    idx  = _mm256_and_si256(_mm256_srlv_epi64(w, HUFF_BATCH_LOAD(bits)),
+                            _mm256_sub_epi64(_mm256_sllv_epi64(one, sub), one));
+    idx  = _mm256_and_si256(link, _mm256_add_epi64(_mm256_srli_epi64(e, 16),
+                                                   idx));
+    e2   = huff_batch_gather_avx2(fast, idx);
+    e    = _mm256_blendv_epi8(e, e2, link);
+    len  = _mm256_and_si256(e, ff);
+  }
+
+  /* window has all bits the lookup depends on */
+  full = _mm256_or_si256(_mm256_cmpgt_epi64(wb, _mm256_set1_epi64x(15)),
+                         _mm256_cmpgt_epi64(_mm256_add_epi64(wb, one), avail));
+  nul  = _mm256_cmpeq_epi64(len, zero);
+  ok   = _mm256_andnot_si256(_mm256_or_si256(nul, _mm256_or_si256(
+                               _mm256_cmpgt_epi64(len, avail),
+                               _mm256_cmpgt_epi64(len, wb))),
+                             act);
+  done = _mm256_and_si256(_mm256_andnot_si256(ok, act), full);
+  d    = _mm256_and_si256(len, ok);
+
+  if (unlikely(!_mm256_testz_si256(done, done))) {
+    /* slow path or invalid code, left to huff_decode_lsb_n() */
+    HUFF_BATCH_STORE(done, _mm256_or_si256(HUFF_BATCH_LOAD(done), done));
+    HUFF_BATCH_STORE(bad,  _mm256_or_si256(HUFF_BATCH_LOAD(bad),
+                                           _mm256_and_si256(done, nul)));
+  }
+
+  HUFF_BATCH_STORE(sym[s], _mm256_srli_epi64(e, 16));
+  HUFF_BATCH_STORE(win,    _mm256_srlv_epi64(w, d));
+  HUFF_BATCH_STORE(wbits,  _mm256_sub_epi64(wb, d));
+  HUFF_BATCH_STORE(bitp,   _mm256_add_epi64(HUFF_BATCH_LOAD(bitp), d));
+  HUFF_BATCH_STORE(rem,    _mm256_add_epi64(rem, ok));
+  HUFF_BATCH_STORE(cnt,    _mm256_sub_epi64(HUFF_BATCH_LOAD(cnt), ok));
+}
+
+#if defined(__AVX512F__)
+
+#define HUFF_BATCH_LOAD512(name)  _mm512_load_si512((const void *)(L->name + q))
+#define HUFF_BATCH_STORE512(name, v)                                           \
+  _mm512_store_si512((void *)(L->name + q), v)
+
+/* same as huff_batch_window_avx2() for lanes `q..q+7` */
+HUFF_INLINE
+void
+huff_batch_window_avx512(huff_batch_lanes_t * __restrict L, unsigned q) {
+  __m512i bitp, addr, sh, w;
+
+  bitp = HUFF_BATCH_LOAD512(bitp);
+  addr = _mm512_min_epu64(_mm512_srli_epi64(bitp, 3), HUFF_BATCH_LOAD512(lim));
+  sh   = _mm512_sub_epi64(bitp, _mm512_slli_epi64(addr, 3));
+  w    = _mm512_i64gather_epi64(addr, (const void *)0, 1);
+
+  HUFF_BATCH_STORE512(win,   _mm512_srlv_epi64(w, sh));
+  HUFF_BATCH_STORE512(wbits, _mm512_sub_epi64(_mm512_set1_epi64(64), sh));
+  HUFF_BATCH_STORE512(cnt,   _mm512_setzero_si512());
+  HUFF_BATCH_STORE512(done,  _mm512_setzero_si512());
+  HUFF_BATCH_STORE512(bad,   _mm512_setzero_si512());
+}
+
+/* same as huff_batch_step_avx2() for lanes `q..q+7` */
+HUFF_INLINE
+void
+huff_batch_step_avx512(huff_batch_lanes_t * __restrict L, unsigned q, unsigned s) {
+  const __m512i zero = _mm512_setzero_si512(),
+                one  = _mm512_set1_epi64(1),
+                ff   = _mm512_set1_epi64(0xff);
+  __m512i   fast, w, wb, rem, e, len, sub, idx, avail, addr;
+  __mmask8  act, link, full, nul, ok, done;
+
+  fast  = HUFF_BATCH_LOAD512(fast);
+  w     = HUFF_BATCH_LOAD512(win);
+  wb    = HUFF_BATCH_LOAD512(wbits);
+  rem   = HUFF_BATCH_LOAD512(rem);
+  avail = _mm512_sub_epi64(HUFF_BATCH_LOAD512(endp), HUFF_BATCH_LOAD512(bitp));
+  act   = _mm512_cmpgt_epu64_mask(rem, zero)
+        & _mm512_cmpeq_epi64_mask(HUFF_BATCH_LOAD512(cnt), _mm512_set1_epi64(s));
+
+  idx  = _mm512_and_si512(w, HUFF_BATCH_LOAD512(mask));
+  addr = _mm512_add_epi64(fast, _mm512_slli_epi64(idx, 2));
+  e    = _mm512_cvtepu32_epi64(_mm512_i64gather_epi32(addr, (const void *)0, 1));
+  len  = _mm512_and_si512(e, ff);
+
+  /* sub table links */
+  link = act & _mm512_cmpeq_epi64_mask(len, zero);
+  if (unlikely(link)) {
+    sub  = _mm512_and_si512(_mm512_srli_epi64(e, 8), ff);
+    link = link & _mm512_cmpneq_epi64_mask(sub, zero);
+    idx  = _mm512_and_si512(_mm512_srlv_epi64(w, HUFF_BATCH_LOAD512(bits)),
+                            _mm512_sub_epi64(_mm512_sllv_epi64(one, sub), one));
+    idx  = _mm512_add_epi64(_mm512_srli_epi64(e, 16), idx);
+    addr = _mm512_add_epi64(fast, _mm512_slli_epi64(idx, 2));
+    e    = _mm512_mask_mov_epi64(e, link, _mm512_cvtepu32_epi64(
+             _mm512_mask_i64gather_epi32(_mm256_setzero_si256(), link, addr,
+                                         (const void *)0, 1)));
+    len  = _mm512_and_si512(e, ff);
+  }
+
+  full = _mm512_cmpgt_epu64_mask(wb, _mm512_set1_epi64(15))
+       | _mm512_cmpge_epu64_mask(wb, avail);
+  nul  = _mm512_cmpeq_epi64_mask(len, zero);
+  ok   = act & ~nul & _mm512_cmple_epu64_mask(len, avail)
+                    & _mm512_cmple_epu64_mask(len, wb);
+  done = act & ~ok & full;
+  len  = _mm512_maskz_mov_epi64(ok, len);
+
+  if (unlikely(done)) {
+    HUFF_BATCH_STORE512(done, _mm512_mask_mov_epi64(HUFF_BATCH_LOAD512(done),
+                                                     done, _mm512_set1_epi64(-1)));
+    HUFF_BATCH_STORE512(bad,  _mm512_mask_mov_epi64(HUFF_BATCH_LOAD512(bad),
+                                                     done & nul,
+                                                     _mm512_set1_epi64(-1)));
+  }
+
+  HUFF_BATCH_STORE512(sym[s], _mm512_srli_epi64(e, 16));
+  HUFF_BATCH_STORE512(win,    _mm512_srlv_epi64(w, len));
+  HUFF_BATCH_STORE512(wbits,  _mm512_sub_epi64(wb, len));
+  HUFF_BATCH_STORE512(bitp,   _mm512_add_epi64(HUFF_BATCH_LOAD512(bitp), len));
+  HUFF_BATCH_STORE512(rem,    _mm512_mask_sub_epi64(rem, ok, rem, one));
+  HUFF_BATCH_STORE512(cnt,    _mm512_mask_add_epi64(HUFF_BATCH_LOAD512(cnt), ok,
+                                                    HUFF_BATCH_LOAD512(cnt), one));
+}
+
+#endif /* __AVX512F__ */
+
+#endif /* __AVX2__ */
+
+HUFF_INLINE
+bool
+huff_decode_lsb_batch_scalar(huff_record_t * __restrict recs, size_t n) {
+  size_t i;
+  bool   ok;
+
+  for (i = 0, ok = true; i < n; i++) {
+    recs[i].decoded = 0;
+    huff_batch_finish(&recs[i], 0);
+    ok &= recs[i].err == HUFF_OK;
+  }
+
+  return ok;
+}
+
+/*!
+ * @brief Decodes many independent LSB-first records.
+ *
+ * Each record is decoded as `huff_decode_lsb_n()` would decode it from a
+ * reader of `in` / `in_len`: up to `count` symbols are written to `out`,
+ * `decoded` and `err` are set. Records may use different tables.
+ *
+ * @param[in, out] recs  Records.
+ * @param[in]      n     Number of records.
+ *
+ * @return `false` if an invalid code is found in any record.
+ */
+HUFF_INLINE
+bool
+huff_decode_lsb_batch(huff_record_t * __restrict recs, size_t n) {
+#if defined(__AVX2__)
+  huff_batch_lanes_t L;
+  huff_record_t     *lane[HUFF_BATCH_LANES], *rec;
+  uint64_t           bitp;
+  size_t             next, c;
+  unsigned           k, s, busy;
+  bool               ok;
+
+  if (!n)
+    return true;
+
+  next = 0;
+  busy = 0;
+  ok   = true;
+
+  memset(L.pad, 0, sizeof(L.pad));
+  for (k = 0; k < HUFF_BATCH_LANES; k++) {
+    lane[k]   = NULL;
+    L.base[k] = L.pad[k];
+    L.bitp[k] = L.endp[k] = (uint64_t)(uintptr_t)L.pad[k] * 8;
+    L.lim[k]  = (uint64_t)(uintptr_t)L.pad[k];
+    L.fast[k] = (uint64_t)(uintptr_t)recs[0].table->fast;
+    L.mask[k] = L.bits[k] = L.rem[k] = 0;
+  }
+
+  do {
+    /* free lanes take next records */
+    for (k = 0; k < HUFF_BATCH_LANES; k++) {
+      while (!lane[k] && next < n) {
+        rec          = &recs[next++];
+        rec->decoded = 0;
+        rec->err     = HUFF_OK;
+        if (!rec->count)
+          continue;
+
+        if (rec->in_len >= 8) {
+          L.base[k] = rec->in;
+          L.lim[k]  = (uint64_t)(uintptr_t)(rec->in + rec->in_len - 8);
+        } else {
+          /* last 8 bytes of pad stay zero */
+          memset(L.pad[k], 0, 8);
+          if (rec->in_len)
+            memcpy(L.pad[k], rec->in, rec->in_len);
+          L.base[k] = L.pad[k];
+          L.lim[k]  = (uint64_t)(uintptr_t)(L.pad[k] + 8);
+        }
+
+        lane[k]   = rec;
+        L.bitp[k] = (uint64_t)(uintptr_t)L.base[k] * 8;
+        L.endp[k] = L.bitp[k] + (uint64_t)rec->in_len * 8;
+        L.fast[k] = (uint64_t)(uintptr_t)rec->table->fast;
+        L.bits[k] = rec->table->bits;
+        L.mask[k] = (1U << rec->table->bits) - 1;
+        L.rem[k]  = rec->count;
+        busy++;
+      }
+    }
+
+    /* each step is independent across lanes, hides gather latency */
+#if defined(__AVX512F__)
+    for (k = 0; k < HUFF_BATCH_LANES; k += 8)
+      huff_batch_window_avx512(&L, k);
+
+    for (s = 0; s < HUFF_BATCH_STEPS; s++)
+      for (k = 0; k < HUFF_BATCH_LANES; k += 8)
+        huff_batch_step_avx512(&L, k, s);
+#else
+    for (k = 0; k < HUFF_BATCH_LANES; k += 4)
+      huff_batch_window_avx2(&L, k);
+
+    for (s = 0; s < HUFF_BATCH_STEPS; s++)
+      for (k = 0; k < HUFF_BATCH_LANES; k += 4)
+        huff_batch_step_avx2(&L, k, s);
+#endif
+
+    for (k = 0; k < HUFF_BATCH_LANES; k++) {
+      if (!(rec = lane[k]))
+        continue;
+
+      c = (size_t)L.cnt[k];
+      for (s = 0; s < c; s++)
+        rec->out[rec->decoded + s] = (uint16_t)L.sym[s][k];
+      rec->decoded += c;
+
+      if (L.rem[k] && !L.done[k])
+        continue;
+
+      /* done: count reached, input ended or len 0 entry */
+      if (L.rem[k] && L.bad[k]) {
+        bitp = L.bitp[k] - (uint64_t)(uintptr_t)L.base[k] * 8;
+        huff_batch_finish(rec, (size_t)bitp);
+        ok  &= rec->err == HUFF_OK;
+      }
+
+      L.rem[k] = 0;
+      lane[k]  = NULL;
+      busy--;
+    }
+  } while (busy || next < n);
+
+  return ok;
+#else
+  return huff_decode_lsb_batch_scalar(recs, n);
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* huff_batch_h */
@@ -0,0 +1,356 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * bounded, thread-safe cache of built tables keyed by code lengths. streams
+ * of the same encoder often repeat their dynamic Huffman headers, a hit skips
+ * table construction. tables are immutable and refcounted, release each
+ * table returned by huff_cache_*() with huff_cache_release().
+ *
+ * not included by huff.h, needs pthreads (or SRW locks on windows).
+ */
+
+#ifndef huff_cache_h
+#define huff_cache_h
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "huff.h"
+#include "thread.h"
+
+#define HUFF_CACHE_LSB        0
+#define HUFF_CACHE_LSB_EXTOF  1
+
+typedef struct huff_cache_entry_t {
+  union {                             /* first member, given to callers     */
+    huff_table_t     lsb;
+    huff_table_ext_t ext;
+  } table;
+  struct huff_cache_entry_t *next;    /* bucket chain                       */
+  const huff_ext_t          *extras;
+  uint64_t                   hash;
+  size_t                     refs;
+  int                        offset;
+  uint16_t                   n;
+  uint8_t                    kind;
+  uint8_t                    cached;  /* 0 if cache was full of used tables */
+  uint8_t                    recent;  /* clock bit                          */
+  uint8_t                    lengths[HUFF_MAX_CODES];
+} huff_cache_entry_t;
+
+typedef struct huff_cache_t {
+  huff_mutex_t         lock;
+  huff_cache_entry_t **buckets;
+  huff_cache_entry_t **slots;
+  size_t               nbuckets;
+  size_t               capacity;
+  size_t               count;
+  size_t               hand;
+  size_t               hits;
+  size_t               misses;
+} huff_cache_t;
+
+HUFF_INLINE
+void*
+huff_cache_aligned_alloc(size_t size) {
+  size = (size + 31) & ~(size_t)31;
+#if defined(_WIN32)
+  return _aligned_malloc(size, 32);
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+  return aligned_alloc(32, size);
+#else
+  void *p;
+  return posix_memalign(&p, 32, size) ? NULL : p;
+#endif
+}
+
+HUFF_INLINE
+void
+huff_cache_aligned_free(void *p) {
+#if defined(_WIN32)
+  _aligned_free(p);
+#else
+  free(p);
+#endif
+}
+
+/*!
+ * @brief Creates a cache which holds up to `capacity` tables.
+ *
+ * @return cache or NULL on allocation failure.
+ */
+HUFF_INLINE
+huff_cache_t*
+huff_cache_new(size_t capacity) {
+  huff_cache_t *cache;
+  size_t        nbuckets;
+
+  if (!capacity || !(cache = (huff_cache_t *)calloc(1, sizeof(*cache))))
+    return NULL;
+
+  for (nbuckets = 16; nbuckets < capacity * 2; nbuckets <<= 1);
+
+  cache->buckets  = (huff_cache_entry_t **)calloc(nbuckets, sizeof(void *));
+  cache->slots    = (huff_cache_entry_t **)calloc(capacity, sizeof(void *));
+  cache->nbuckets = nbuckets;
+  cache->capacity = capacity;
+
+  if (!cache->buckets || !cache->slots) {
+    free(cache->buckets);
+    free(cache->slots);
+    free(cache);
+    return NULL;
+  }
+
+  huff_mutex_init(&cache->lock);
+  return cache;
+}
+
+/*!
+ * @brief Frees cache and its tables, all tables must be released.
+ */
+HUFF_INLINE
+void
+huff_cache_free(huff_cache_t *cache) {
+  size_t i;
+
+  if (!cache)
+    return;
+
+  for (i = 0; i < cache->count; i++)
+    huff_cache_aligned_free(cache->slots[i]);
+
+  huff_mutex_destroy(&cache->lock);
+  free(cache->buckets);
+  free(cache->slots);
+  free(cache);
+}
+
+HUFF_INLINE
+uint64_t
+huff_cache_hash(const uint8_t * __restrict lengths,
+                uint16_t                   n,
+                const huff_ext_t          *extras,
+                int                        offset,
+                uint8_t                    kind) {
+  uint64_t h;
+  uint16_t i;
+
+  /* FNV-1a */
+  h = 0xcbf29ce484222325ULL;
+  for (i = 0; i < n; i++)
+    h = (h ^ lengths[i]) * 0x100000001b3ULL;
+
+  h ^= ((uint64_t)n << 32) ^ ((uint64_t)kind << 48) ^ (uint64_t)(uint32_t)offset;
+  h ^= (uint64_t)(uintptr_t)extras * 0x9e3779b97f4a7c15ULL;
+  return h ^ (h >> 29);
+}
+
+HUFF_INLINE
+huff_cache_entry_t*
+huff_cache_find(huff_cache_t  * __restrict cache,
+                uint64_t                   hash,
+                const uint8_t * __restrict lengths,
+                uint16_t                   n,
+                const huff_ext_t          *extras,
+                int                        offset,
+                uint8_t                    kind) {
+  huff_cache_entry_t *e;
+
+  for (e = cache->buckets[hash & (cache->nbuckets - 1)]; e; e = e->next) {
+    if (e->hash == hash && e->n == n && e->kind == kind && e->extras == extras
+        && e->offset == offset && memcmp(e->lengths, lengths, n) == 0)
+      return e;
+  }
+
+  return NULL;
+}
+
+/* takes a slot for a new entry, evicts an unused table if cache is full */
+HUFF_INLINE
+bool
+huff_cache_insert(huff_cache_t * __restrict cache, huff_cache_entry_t *e) {
+  huff_cache_entry_t *victim, **link;
+  size_t              i, slot;
+
+  if (cache->count < cache->capacity) {
+    slot = cache->count++;
+  } else {
+    /* clock: skip tables in use, give recently used ones a second chance */
+    victim = NULL;
+    slot   = 0;
+    for (i = 0; i < cache->capacity * 2; i++) {
+      slot = cache->hand;
+      cache->hand = (cache->hand + 1) % cache->capacity;
+
+      victim = cache->slots[slot];
+      if (victim->refs)
+        continue;
+      if (victim->recent) {
+        victim->recent = 0;
+        continue;
+      }
+      break;
+    }
+
+    if (!victim || victim->refs || victim->recent)
+      return false;
+
+    link = &cache->buckets[victim->hash & (cache->nbuckets - 1)];
+    while (*link != victim)
+      link = &(*link)->next;
+    *link = victim->next;
+
+    huff_cache_aligned_free(victim);
+  }
+
+  cache->slots[slot] = e;
+  e->next            = cache->buckets[e->hash & (cache->nbuckets - 1)];
+  e->cached          = 1;
+  cache->buckets[e->hash & (cache->nbuckets - 1)] = e;
+  return true;
+}
+
+HUFF_INLINE
+const void*
+huff_cache_get(huff_cache_t     * __restrict cache,
+               const uint8_t    * __restrict lengths,
+               uint16_t                      n,
+               const huff_ext_t             *extras,
+               int                           offset,
+               uint8_t                       kind) {
+  huff_cache_entry_t *e, *found;
+  uint64_t            hash;
+  bool                ok;
+
+  if (n > HUFF_MAX_CODES)
+    return NULL;
+
+  hash = huff_cache_hash(lengths, n, extras, offset, kind);
+
+  huff_mutex_lock(&cache->lock);
+  if ((found = huff_cache_find(cache, hash, lengths, n, extras, offset, kind))) {
+    found->refs++;
+    found->recent = 1;
+    cache->hits++;
+    huff_mutex_unlock(&cache->lock);
+    return &found->table;
+  }
+  cache->misses++;
+  huff_mutex_unlock(&cache->lock);
+
+  /* build outside of the lock */
+  if (!(e = (huff_cache_entry_t *)huff_cache_aligned_alloc(sizeof(*e))))
+    return NULL;
+
+  if (kind == HUFF_CACHE_LSB)
+    ok = huff_init_lsb(&e->table.lsb, lengths, NULL, n);
+  else
+    ok = huff_init_lsb_extof(&e->table.ext, lengths, NULL, extras, offset, n);
+
+  if (!ok) {
+    huff_cache_aligned_free(e);
+    return NULL;
+  }
+
+  memcpy(e->lengths, lengths, n);
+  e->next   = NULL;
+  e->extras = extras;
+  e->hash   = hash;
+  e->refs   = 1;
+  e->offset = offset;
+  e->n      = n;
+  e->kind   = kind;
+  e->cached = 0;
+  e->recent = 1;
+
+  huff_mutex_lock(&cache->lock);
+
+  /* another thread built the same table meanwhile */
+  if ((found = huff_cache_find(cache, hash, lengths, n, extras, offset, kind))) {
+    found->refs++;
+    found->recent = 1;
+    huff_mutex_unlock(&cache->lock);
+    huff_cache_aligned_free(e);
+    return &found->table;
+  }
+
+  /* full of tables in use: table is owned by caller until release */
+  huff_cache_insert(cache, e);
+  huff_mutex_unlock(&cache->lock);
+
+  return &e->table;
+}
+
+/*!
+ * @brief Returns a table for `lengths` built by `huff_init_lsb()`, from cache
+ *        if the same lengths were used before.
+ *
+ * @return table, NULL if lengths are invalid or on allocation failure.
+ */
+HUFF_INLINE
+const huff_table_t*
+huff_cache_lsb(huff_cache_t  * __restrict cache,
+               const uint8_t * __restrict lengths,
+               uint16_t                   n) {
+  return (const huff_table_t *)huff_cache_get(cache, lengths, n, NULL, 0,
+                                              HUFF_CACHE_LSB);
+}
+
+/*!
+ * @brief Same as `huff_cache_lsb()` for `huff_init_lsb_extof()` tables, key
+ *        includes `extras` pointer and `offset`.
+ */
+HUFF_INLINE
+const huff_table_ext_t*
+huff_cache_lsb_extof(huff_cache_t     * __restrict cache,
+                     const uint8_t    * __restrict lengths,
+                     uint16_t                      n,
+                     const huff_ext_t             *extras,
+                     int                           offset) {
+  return (const huff_table_ext_t *)huff_cache_get(cache, lengths, n, extras,
+                                                  offset, HUFF_CACHE_LSB_EXTOF);
+}
+
+/*!
+ * @brief Releases a table returned by `huff_cache_lsb()` or
+ *        `huff_cache_lsb_extof()`.
+ */
+HUFF_INLINE
+void
+huff_cache_release(huff_cache_t * __restrict cache, const void *table) {
+  huff_cache_entry_t *e;
+  bool                drop;
+
+  if (!table)
+    return;
+
+  e = (huff_cache_entry_t *)table;
+
+  huff_mutex_lock(&cache->lock);
+  drop = !--e->refs && !e->cached;
+  huff_mutex_unlock(&cache->lock);
+
+  if (drop)
+    huff_cache_aligned_free(e);
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* huff_cache_h */
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * compiled library (huffc) versions of hot functions. each call goes through
+ * a function table which is resolved once by cpuid, so a baseline build runs
+ * AVX2 / BMI2 code where it is available. build with -DHUFF_BUILD_LIBRARY=ON
+ * and link huffc.
+ */
+
+#ifndef huff_call_h
+#define huff_call_h
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "huff.h"
+
+/*!
+ * @brief name of selected implementation e.g. "avx2" or "base"
+ */
+HUFF_EXPORT
+const char*
+huffc_impl_name(void);
+
+HUFF_EXPORT
+int
+huffc_read(const uint8_t ** __restrict buff,
+           bitstream_t    * __restrict bits,
+           const uint8_t  * __restrict end);
+
+HUFF_EXPORT
+bool
+huffc_init_lsb_bits(huff_table_t   * __restrict table,
+                    const uint8_t  * __restrict lengths,
+                    const uint16_t * __restrict symbols,
+                    uint16_t                    n,
+                    uint8_t                     fast_bits);
+
+HUFF_EXPORT
+bool
+huffc_init_msb_bits(huff_table_t   * __restrict table,
+                    const uint8_t  * __restrict lengths,
+                    const uint16_t * __restrict symbols,
+                    uint16_t                    n,
+                    uint8_t                     fast_bits);
+
+HUFF_EXPORT
+bool
+huffc_init_lsb_extof_bits(huff_table_ext_t   * __restrict table,
+                          const uint8_t      * __restrict lengths,
+                          const uint16_t     * __restrict symbols,
+                          const huff_ext_t   * __restrict extras,
+                          int                             offset,
+                          uint16_t                        n,
+                          uint8_t                         fast_bits);
+
+HUFF_EXPORT
+size_t
+huffc_decode_lsb_n(const huff_table_t * __restrict table,
+                   huff_reader_t      * __restrict reader,
+                   uint16_t           * __restrict out,
+                   size_t                          count);
+
+HUFF_EXPORT
+size_t
+huffc_decode_lsb_multi_n(const huff_table_multi_t * __restrict table,
+                         huff_reader_t            * __restrict reader,
+                         uint16_t                 * __restrict out,
+                         size_t                                count);
+
+HUFF_EXPORT
+bool
+huffc_decode_lsb_streams(const huff_table_t * __restrict table,
+                         huff_reader_t      * __restrict readers,
+                         uint16_t          ** __restrict out,
+                         size_t             * __restrict counts,
+                         unsigned                        nstreams);
+
+HUFF_EXPORT
+bool
+huffc_decode_lsb_batch(huff_record_t * __restrict recs, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* huff_call_h */
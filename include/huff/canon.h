@@ -0,0 +1,642 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef huff_canon_h
+#define huff_canon_h
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <string.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+/* fast_bits of table builders: pick bits by code lengths */
+#define HUFF_FAST_BITS_AUTO  0
+
+/* results of huff_code_check() */
+#define HUFF_CODE_COMPLETE        0
+#define HUFF_CODE_INCOMPLETE      1 /* unused code space, e.g. single code   */
+#define HUFF_CODE_OVERSUBSCRIBED  2 /* more codes than code space (Kraft)    */
+#define HUFF_CODE_BAD_LENGTH      3 /* a length above HUFF_MAX_CODE_LENGTH   */
+
+/*!
+ * @brief Checks code lengths against the Kraft inequality.
+ *
+ * Table builders trust their lengths, lengths from untrusted input should be
+ * checked once before building, e.g. by `huff_init_lsb_checked()`.
+ *
+ * @param[in] lengths  code lengths, 0 for unused symbols
+ * @param[in] n        number of lengths
+ *
+ * @return one of `HUFF_CODE_*`, an empty code is incomplete.
+ */
+HUFF_INLINE
+int
+huff_code_check(const uint8_t * __restrict lengths, uint16_t n) {
+  uint_fast16_t count[HUFF_MAX_CODE_LENGTH + 1] = {0};
+  int_fast32_t  left;
+  uint16_t      i;
+
+  for (i = 0; i < n; i++) {
+    if (unlikely(lengths[i] > HUFF_MAX_CODE_LENGTH))
+      return HUFF_CODE_BAD_LENGTH;
+    count[lengths[i]]++;
+  }
+
+  /* codes left to assign per length, like inflate's code construction */
+  for (i = 1, left = 1; i <= HUFF_MAX_CODE_LENGTH; i++) {
+    left = (left << 1) - (int_fast32_t)count[i];
+    if (left < 0)
+      return HUFF_CODE_OVERSUBSCRIBED;
+  }
+
+  return left ? HUFF_CODE_INCOMPLETE : HUFF_CODE_COMPLETE;
+}
+
+/*!
+ * @brief Computes canonical codes shared by all table builders.
+ *
+ * Fills first code and count of each length, sentinels (first code after the
+ * last code of each length), offsets (symbol index minus code) and symbols
+ * sorted in canonical order (by length, then by symbol).
+ *
+ * @param[out] sentinels  sentinels per code length
+ * @param[out] offsets    symbol offsets per code length
+ * @param[out] syms       symbols in canonical order, n entries, unused
+ *                        symbols are stored after used ones
+ * @param[out] count      number of codes per length, count[0] is 0
+ * @param[out] code       first code per length
+ * @param[in]  lengths    code lengths
+ * @param[in]  n          number of lengths
+ *
+ * @return max code length, 0 if there is no code.
+ */
+HUFF_INLINE
+uint_fast8_t
+huff_canonical(uint16_t                  sentinels[HUFF_MAX_CODE_LENGTH + 1],
+               uint16_t                  offsets[HUFF_MAX_CODE_LENGTH + 1],
+               uint16_t      * __restrict syms,
+               uint_fast16_t             count[HUFF_MAX_CODE_LENGTH + 1],
+               uint_fast16_t             code[HUFF_MAX_CODE_LENGTH + 1],
+               const uint8_t * __restrict lengths,
+               uint16_t                  n) {
+  /**
+   * lengths are split into 4 ranges with their own counters and positions,
+   * incrementing the same counter over and over again is a store to load
+   * dependency chain, 4 independent chains overlap.
+   */
+  uint_fast16_t cnt[4][HUFF_MAX_CODE_LENGTH + 1] = {{0}};
+  uint_fast16_t pos[4][HUFF_MAX_CODE_LENGTH + 1];
+  uint_fast16_t l, i, q, prev_code, prev_sym_idx;
+  uint_fast8_t  maxlen;
+
+  q = n >> 2;
+
+  for (i = 0; i < q; i++) {
+    cnt[0][lengths[i]]++;
+    cnt[1][lengths[i + q]]++;
+    cnt[2][lengths[i + q * 2]]++;
+    cnt[3][lengths[i + q * 3]]++;
+  }
+
+  for (i = q * 4; i < n; i++)
+    cnt[3][lengths[i]]++;
+
+  prev_code = prev_sym_idx = 0;
+  maxlen    = 0;
+  count[0]  = code[0] = 0;
+
+  for (l = 1; l <= HUFF_MAX_CODE_LENGTH; l++) {
+    count[l]     = cnt[0][l] + cnt[1][l] + cnt[2][l] + cnt[3][l];
+    code[l]      = (prev_code + count[l - 1]) << 1;
+    pos[0][l]    = prev_sym_idx + count[l - 1];
+    sentinels[l] = (uint16_t)(code[l]   + count[l]);
+    offsets[l]   = (uint16_t)(pos[0][l] - code[l]);
+
+    prev_code    = code[l];
+    prev_sym_idx = pos[0][l];
+
+    if (count[l]) maxlen = (uint_fast8_t)l;
+  }
+
+  /* unused symbols are put after used ones, so stores don't need a branch */
+  pos[0][0] = prev_sym_idx + count[HUFF_MAX_CODE_LENGTH];
+
+  for (l = 0; l <= HUFF_MAX_CODE_LENGTH; l++) {
+    pos[1][l] = pos[0][l] + cnt[0][l];
+    pos[2][l] = pos[1][l] + cnt[1][l];
+    pos[3][l] = pos[2][l] + cnt[2][l];
+  }
+
+  for (i = 0; i < q; i++) {
+    syms[pos[0][lengths[i]]++]         = (uint16_t)i;
+    syms[pos[1][lengths[i + q]]++]     = (uint16_t)(i + q);
+    syms[pos[2][lengths[i + q * 2]]++] = (uint16_t)(i + q * 2);
+    syms[pos[3][lengths[i + q * 3]]++] = (uint16_t)(i + q * 3);
+  }
+
+  for (i = q * 4; i < n; i++)
+    syms[pos[3][lengths[i]]++] = (uint16_t)i;
+
+  return maxlen;
+}
+
+/*!
+ * @brief Bits of the sub table that starts with a code of length len.
+ *
+ * Codes are placed in canonical order, so a sub table is wide enough when the
+ * remaining codes fill it, this keeps every code within two lookups.
+ *
+ * @param[in] rem        codes per length which are not placed yet, including
+ *                       the code which starts the sub table
+ * @param[in] len        length of the code which starts the sub table
+ * @param[in] fast_bits  bits of the root table
+ * @param[in] maxlen     max code length
+ */
+HUFF_INLINE
+uint_fast8_t
+huff_subtable_bits(const uint_fast16_t rem[HUFF_MAX_CODE_LENGTH + 1],
+                   uint_fast8_t        len,
+                   uint_fast8_t        fast_bits,
+                   uint_fast8_t        maxlen) {
+  int_fast32_t space;
+  uint_fast8_t bits;
+
+  bits  = len - fast_bits;
+  space = 1 << bits;
+
+  for (;;) {
+    space -= (int_fast32_t)rem[fast_bits + bits];
+    if (space <= 0 || fast_bits + bits >= maxlen)
+      break;
+
+    bits++;
+    space <<= 1;
+  }
+
+  return bits;
+}
+
+/*!
+ * @brief Number of fast table entries (first level and sub tables) needed by
+ *        a code with given counts and fast table bits.
+ *
+ * @param[in] count      number of codes per length
+ * @param[in] fast_bits  bits of the root table
+ * @param[in] maxlen     max code length
+ */
+HUFF_INLINE
+uint_fast32_t
+huff_table_entries(const uint_fast16_t count[HUFF_MAX_CODE_LENGTH + 1],
+                   uint_fast8_t        fast_bits,
+                   uint_fast8_t        maxlen) {
+  uint_fast16_t rem[HUFF_MAX_CODE_LENGTH + 1], take;
+  uint_fast32_t total, left;
+  uint_fast8_t  l;
+
+  for (l = 0; l <= HUFF_MAX_CODE_LENGTH; l++)
+    rem[l] = count[l];
+
+  total = 1U << fast_bits;
+  left  = 0; /* free slots of current sub table at current length */
+
+  for (l = fast_bits + 1; l <= maxlen; l++) {
+    left <<= 1;
+    while (rem[l]) {
+      if (!left) {
+        total += 1U << huff_subtable_bits(rem, l, fast_bits, maxlen);
+        left   = 1U << (l - fast_bits);
+      }
+
+      take    = rem[l] < left ? rem[l] : (uint_fast16_t)left;
+      left   -= take;
+      rem[l] -= take;
+    }
+  }
+
+  return total;
+}
+
+/* fast table bits picked by HUFF_FAST_BITS_AUTO are at least this */
+#define HUFF_FAST_BITS_MIN   8
+
+/* codes in sub tables may be up to 1 / HUFF_SUB_RATE of decoded codes */
+#define HUFF_SUB_RATE        32
+
+/*!
+ * @brief Picks fast table bits of a code, used for `HUFF_FAST_BITS_AUTO`.
+ *
+ * A code of length l is expected to be decoded 2^-l of the time. Smallest
+ * bits in [HUFF_FAST_BITS_MIN, HUFF_FAST_TABLE_BITS] are picked for which
+ * longer codes are at most 1 / HUFF_SUB_RATE of the codes, so build cost
+ * (2^bits entries) follows the alphabet. Codes up to HUFF_FAST_BITS_MIN bits
+ * get a table of their max length, e.g. 7 bits for DEFLATE code lengths.
+ *
+ * @param[in] count   number of codes per length
+ * @param[in] maxlen  max code length
+ */
+HUFF_INLINE
+uint_fast8_t
+huff_table_bits(const uint_fast16_t count[HUFF_MAX_CODE_LENGTH + 1],
+                uint_fast8_t        maxlen) {
+  uint_fast32_t tail, next;
+  uint_fast8_t  b, l;
+
+  b = maxlen < HUFF_FAST_TABLE_BITS ? maxlen : HUFF_FAST_TABLE_BITS;
+
+  /* expected rate of codes longer than b, in 1 / 2^16 */
+  for (tail = 0, l = maxlen; l > b; l--)
+    tail += (uint_fast32_t)count[l] << (HUFF_MAX_CODE_LENGTH - l);
+
+  for (; b > HUFF_FAST_BITS_MIN; b--) {
+    next = tail + ((uint_fast32_t)count[b] << (HUFF_MAX_CODE_LENGTH - b));
+    if (next > (1U << HUFF_MAX_CODE_LENGTH) / HUFF_SUB_RATE)
+      break;
+    tail = next;
+  }
+
+  return b ? b : 1;
+}
+
+/*!
+ * @brief Fast table bits actually used by table builders, increased from
+ *        `fast_bits` while sub tables wouldn't fit in `HUFF_TABLE_ENTRIES`.
+ *
+ * @param[in]  count      number of codes per length
+ * @param[in]  fast_bits  requested bits of the root table or
+ *                        `HUFF_FAST_BITS_AUTO`
+ * @param[in]  maxlen     max code length
+ * @param[in]  exact      count entries even if all of them fit anyway, full
+ *                        size tables just reserve `HUFF_TABLE_ENTRIES`
+ * @param[out] entries    number of fast table entries of the table
+ */
+HUFF_INLINE
+uint_fast8_t
+huff_table_fit(const uint_fast16_t count[HUFF_MAX_CODE_LENGTH + 1],
+               uint_fast8_t        fast_bits,
+               uint_fast8_t        maxlen,
+               bool                exact,
+               uint_fast32_t     * __restrict entries) {
+  uint_fast32_t e;
+
+  if (fast_bits == HUFF_FAST_BITS_AUTO)
+    fast_bits = huff_table_bits(count, maxlen);
+
+  for (;;) {
+    if (fast_bits >= HUFF_FAST_TABLE_BITS && !exact) {
+      e = HUFF_TABLE_ENTRIES;
+      break;
+    }
+
+    e = huff_table_entries(count, fast_bits, maxlen);
+    if (e <= HUFF_TABLE_ENTRIES || fast_bits >= HUFF_FAST_TABLE_BITS)
+      break;
+
+    fast_bits++;
+  }
+
+  *entries = e < HUFF_TABLE_ENTRIES ? e : HUFF_TABLE_ENTRIES;
+  return fast_bits;
+}
+
+/* table sizes are rounded to 32 bytes, so tables can be stored one by one */
+#define HUFF_TABLE_BYTES(type, entries, n)                                    \
+  ((offsetof(type, fast) + (size_t)(entries) * sizeof(((type *)0)->fast[0])   \
+    + (size_t)(n) * sizeof(uint16_t) + 31) & ~(size_t)31)
+
+/* worst case fast table entries of n codes, each sub table is 16 - fb bits */
+HUFF_INLINE
+uint_fast32_t
+huff_table_max_entries(uint16_t n, uint8_t fast_bits) {
+  uint_fast32_t subs, root, e, max;
+  uint8_t       b, hi;
+
+  /* auto bits are in [HUFF_FAST_BITS_MIN, HUFF_FAST_TABLE_BITS] or less */
+  b = hi = fast_bits;
+  if (fast_bits == HUFF_FAST_BITS_AUTO) {
+    b  = HUFF_FAST_BITS_MIN;
+    hi = HUFF_FAST_TABLE_BITS;
+  }
+
+  for (max = 0; b <= hi; b++) {
+    root = 1U << b;
+    subs = n < root ? n : root;
+    e    = root;
+
+    if (b < HUFF_MAX_CODE_LENGTH) {
+      e += subs << (HUFF_MAX_CODE_LENGTH - b);
+      e  = e < HUFF_TABLE_ENTRIES ? e : HUFF_TABLE_ENTRIES;
+    }
+
+    max = e > max ? e : max;
+  }
+
+  return max;
+}
+
+HUFF_INLINE
+uint_fast32_t
+huff_table_entries_lengths(const uint8_t * __restrict lengths,
+                           uint16_t                   n,
+                           uint8_t                    fast_bits) {
+  uint_fast16_t count[HUFF_MAX_CODE_LENGTH + 1] = {0};
+  uint_fast32_t entries;
+  uint_fast8_t  maxlen;
+  uint16_t      i;
+
+  for (i = 0; i < n; i++)
+    count[lengths[i]]++;
+
+  for (maxlen = HUFF_MAX_CODE_LENGTH; maxlen && !count[maxlen]; maxlen--);
+
+  count[0] = 0;
+  huff_table_fit(count, fast_bits, maxlen, true, &entries);
+  return entries;
+}
+
+/*!
+ * @brief Bytes needed by a table of `n` symbols built with `fast_bits` by
+ *        `huff_init_lsb_mem()` or `huff_init_msb_mem()` for any lengths,
+ *        e.g. to pool table memory before lengths are known.
+ *
+ * Codes up to `fast_bits` bits never need more than the first level, use
+ * `huff_table_size_lengths()` for the exact size of given lengths.
+ */
+HUFF_INLINE
+size_t
+huff_table_size(uint16_t n, uint8_t fast_bits) {
+  return HUFF_TABLE_BYTES(huff_table_t,
+                          huff_table_max_entries(n, fast_bits), n);
+}
+
+/*!
+ * @brief Exact bytes needed by a table of given lengths and `fast_bits`.
+ */
+HUFF_INLINE
+size_t
+huff_table_size_lengths(const uint8_t * __restrict lengths,
+                        uint16_t                   n,
+                        uint8_t                    fast_bits) {
+  return HUFF_TABLE_BYTES(huff_table_t,
+                          huff_table_entries_lengths(lengths, n, fast_bits), n);
+}
+
+/*!
+ * @brief Same as `huff_table_size()` for `huff_init_lsb_extof_mem()`.
+ */
+HUFF_INLINE
+size_t
+huff_table_ext_size(uint16_t n, uint8_t fast_bits) {
+  return HUFF_TABLE_BYTES(huff_table_ext_t,
+                          huff_table_max_entries(n, fast_bits), n);
+}
+
+/*!
+ * @brief Same as `huff_table_size_lengths()` for `huff_init_lsb_extof_mem()`.
+ */
+HUFF_INLINE
+size_t
+huff_table_ext_size_lengths(const uint8_t * __restrict lengths,
+                            uint16_t                   n,
+                            uint8_t                    fast_bits) {
+  return HUFF_TABLE_BYTES(huff_table_ext_t,
+                          huff_table_entries_lengths(lengths, n, fast_bits), n);
+}
+
+HUFF_INLINE
+unsigned
+huff_ctz32(uint32_t x) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long i;
+  _BitScanForward(&i, x);
+  return (unsigned)i;
+#else
+  return (unsigned)__builtin_ctz(x);
+#endif
+}
+
+HUFF_INLINE
+unsigned
+huff_ctz64(uint64_t x) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long i;
+  _BitScanForward64(&i, x);
+  return (unsigned)i;
+#else
+  return (unsigned)__builtin_ctzll(x);
+#endif
+}
+
+/*!
+ * @brief Length of the code at the top of a 16 bit window, searched in
+ *        sentinels for lengths above `fast_bits`.
+ *
+ * `code < sentinels[l]` for the first l bits of the window is checked for
+ * all lengths at once: sentinels are left-justified to 16 bits, the carry of
+ * `sentinels[l] << (16 - l)` (a full code space, 65536) is kept separately for
+ * l < 16. The first length which matches is found by a mask, without a branch
+ * per length, so latency doesn't depend on input.
+ *
+ * `sentinels[16]` of a complete code reaching 16 bits is 65536 and wraps to 0
+ * in `uint16_t`, so such 16 bit codes are never found here. Builders always fit
+ * sub tables of complete codes (see `HUFF_SUB_TABLE_SIZE`), their codes never
+ * reach the slow path; `HUFF_ASSERT_NO_SLOW()` checks that with `DEBUG`.
+ *
+ * @param[in] sentinels  sentinels (maxcode) of the table
+ * @param[in] w          next 16 bits, first bit of the code is the MSB
+ * @param[in] fast_bits  lengths up to fast_bits are skipped
+ *
+ * @return code length, 0 if there is no such code.
+ */
+HUFF_INLINE
+unsigned
+huff_code_length(const uint16_t sentinels[HUFF_MAX_CODE_LENGTH + 1],
+                 uint16_t       w,
+                 unsigned       fast_bits) {
+#if defined(__ARM_NEON)
+  static const int16_t lsh[16] = {15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0};
+  static const int16_t rsh[16] = {-1,-2,-3,-4,-5,-6,-7,-8,
+                                  -9,-10,-11,-12,-13,-14,-15,-16};
+  uint16x8_t s0, s1, w8, m0, m1;
+  uint8x16_t m;
+  uint64_t   mask;
+
+  /* lanes are lengths 1..8 and 9..16 */
+  s0 = vld1q_u16(sentinels + 1);
+  s1 = vld1q_u16(sentinels + 9);
+  w8 = vdupq_n_u16(w);
+
+  /* w < lo or carry (hi, s >> l) */
+  m0 = vorrq_u16(vcgtq_u16(vshlq_u16(s0, vld1q_s16(lsh)), w8),
+                 vtstq_u16(vshlq_u16(s0, vld1q_s16(rsh)), vdupq_n_u16(0xFFFF)));
+  m1 = vorrq_u16(vcgtq_u16(vshlq_u16(s1, vld1q_s16(lsh + 8)), w8),
+                 vtstq_u16(vshlq_u16(s1, vld1q_s16(rsh + 8)), vdupq_n_u16(0xFFFF)));
+
+  /* 4 bits per length */
+  m    = vcombine_u8(vmovn_u16(m0), vmovn_u16(m1));
+  mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m),
+                                                       4)), 0);
+  mask &= ~0ULL << (fast_bits * 4);
+
+  return mask ? huff_ctz64(mask) / 4 + 1 : 0;
+#elif defined(__SSE2__) || defined(_M_X64)
+  __m128i  s0, s1, p0, p1, w8, z, m0, m1;
+  uint32_t mask;
+
+  /* lanes are lengths 1..8 and 9..16, p is 2^(16 - l) */
+  s0 = _mm_loadu_si128((const __m128i *)(const void *)(sentinels + 1));
+  s1 = _mm_loadu_si128((const __m128i *)(const void *)(sentinels + 9));
+  p0 = _mm_setr_epi16(-32768, 16384, 8192, 4096, 2048, 1024, 512, 256);
+  p1 = _mm_setr_epi16(128, 64, 32, 16, 8, 4, 2, 1);
+  w8 = _mm_set1_epi16((short)w);
+  z  = _mm_setzero_si128();
+
+  /* w < lo or carry (hi), unsigned compare by saturating subtract */
+  m0 = _mm_or_si128(_mm_subs_epu16(_mm_mullo_epi16(s0, p0), w8),
+                    _mm_mulhi_epu16(s0, p0));
+  m1 = _mm_or_si128(_mm_subs_epu16(_mm_mullo_epi16(s1, p1), w8),
+                    _mm_mulhi_epu16(s1, p1));
+
+  /* 1 bit per length */
+  mask = ~(uint32_t)_mm_movemask_epi8(_mm_packs_epi16(_mm_cmpeq_epi16(m0, z),
+                                                      _mm_cmpeq_epi16(m1, z)));
+  mask = (mask & 0xFFFF) & (~0U << fast_bits);
+
+  return mask ? huff_ctz32(mask) + 1 : 0;
+#else
+  unsigned l;
+
+  for (l = fast_bits + 1; l <= HUFF_MAX_CODE_LENGTH; l++) {
+    if ((unsigned)(w >> (16 - l)) < sentinels[l])
+      return l;
+  }
+
+  return 0;
+#endif
+}
+
+#ifdef DEBUG
+/*
+ * true if no window of a table goes to the slow path: every fast entry is a
+ * code or a link, every sub table entry is a code. fast entries of all table
+ * kinds start with len, sub, sym.
+ */
+HUFF_INLINE
+bool
+huff_table_no_slow(const void *fast, size_t entry_size, unsigned bits) {
+  const uint8_t    *p;
+  huff_fast_entry_t fe, se;
+  uint_fast32_t     i, j;
+
+  p = (const uint8_t *)fast;
+  for (i = 0; i < (1U << bits); i++) {
+    memcpy(&fe, p + i * entry_size, sizeof(fe));
+    if (fe.len)
+      continue;
+    if (!fe.sub)
+      return false;
+
+    for (j = 0; j < (1U << fe.sub); j++) {
+      memcpy(&se, p + (fe.sym + j) * entry_size, sizeof(se));
+      if (!se.len)
+        return false;
+    }
+  }
+
+  return true;
+}
+
+/* complete codes must not leave slow path entries, huff_code_length() */
+#  define HUFF_ASSERT_NO_SLOW(table, lengths, n)                              \
+  assert(huff_code_check(lengths, n) != HUFF_CODE_COMPLETE                    \
+         || huff_table_no_slow((table)->fast, sizeof((table)->fast[0]),       \
+                               (table)->bits))
+#else
+#  define HUFF_ASSERT_NO_SLOW(table, lengths, n) ((void)0)
+#endif
+
+/*!
+ * @brief Stores n copies of a 4 byte entry with vector stores.
+ *
+ * MSB-first tables (and sub tables) are filled with contiguous runs.
+ */
+HUFF_INLINE
+void
+huff_fill32(void * __restrict dst, uint32_t v, size_t n) {
+  uint8_t *p;
+  size_t   i;
+
+  p = (uint8_t *)dst;
+  i = 0;
+
+#if defined(__AVX2__)
+  if (n >= 8) {
+    __m256i x8 = _mm256_set1_epi32((int)v);
+    for (; i + 8 <= n; i += 8)
+      _mm256_storeu_si256((__m256i *)(p + i * 4), x8);
+  }
+#endif
+#if defined(__ARM_NEON)
+  if (n >= 4) {
+    uint32x4_t x4 = vdupq_n_u32(v);
+    for (; i + 4 <= n; i += 4)
+      vst1q_u32((uint32_t *)(void *)(p + i * 4), x4);
+  }
+#elif defined(__SSE2__) || defined(_M_X64)
+  if (n >= 4) {
+    __m128i x4 = _mm_set1_epi32((int)v);
+    for (; i + 4 <= n; i += 4)
+      _mm_storeu_si128((__m128i *)(p + i * 4), x4);
+  }
+#endif
+
+  for (; i < n; i++)
+    memcpy(p + i * 4, &v, 4);
+}
+
+/*!
+ * @brief Doubles first `cur` entries until there are `size` entries.
+ *
+ * In LSB-first tables an entry of a code of length l repeats at every 2^l
+ * entries, storing codes of each length once into the first 2^l entries and
+ * doubling them for the next length replaces strided fills with memcpy.
+ */
+HUFF_INLINE
+void
+huff_fill_double(void * __restrict table,
+                 size_t            cur,
+                 size_t            size,
+                 size_t            entry_size) {
+  uint8_t *p;
+
+  p = (uint8_t *)table;
+  for (; cur < size; cur <<= 1)
+    memcpy(p + cur * entry_size, p, cur * entry_size);
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* huff_canon_h */
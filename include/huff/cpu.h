@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef huff_cpu_h
+#define huff_cpu_h
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#  include <intrin.h>
+#  define HUFF_CPU_X86 1
+#elif defined(__x86_64__) || defined(__i386__)
+#  include <cpuid.h>
+#  define HUFF_CPU_X86 1
+#endif
+
+/* runtime cpu features, see huff_cpu_features() */
+#define HUFF_CPU_SSE2    (1U << 0)
+#define HUFF_CPU_SSE42   (1U << 1)
+#define HUFF_CPU_AVX2    (1U << 2)
+#define HUFF_CPU_BMI2    (1U << 3)
+#define HUFF_CPU_AVX512  (1U << 4) /* F and BW                              */
+#define HUFF_CPU_NEON    (1U << 5)
+#define HUFF_CPU_BMI1    (1U << 6)
+#define HUFF_CPU_LZCNT   (1U << 7)
+
+#ifdef HUFF_CPU_X86
+HUFF_INLINE
+void
+huff_cpuid(unsigned leaf, unsigned sub, unsigned r[4]) {
+#if defined(_MSC_VER)
+  int v[4];
+  __cpuidex(v, (int)leaf, (int)sub);
+  r[0] = (unsigned)v[0]; r[1] = (unsigned)v[1];
+  r[2] = (unsigned)v[2]; r[3] = (unsigned)v[3];
+#else
+  __cpuid_count(leaf, sub, r[0], r[1], r[2], r[3]);
+#endif
+}
+
+HUFF_INLINE
+uint64_t
+huff_xgetbv(void) {
+#if defined(_MSC_VER)
+  return (uint64_t)_xgetbv(0);
+#else
+  unsigned lo, hi;
+  __asm__ __volatile__ ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+  return ((uint64_t)hi << 32) | lo;
+#endif
+}
+#endif
+
+/*!
+ * @brief Detects cpu features which are usable at runtime.
+ *
+ * AVX2 and AVX-512 are only reported if the OS saves the wider registers.
+ * Detection runs cpuid each time, cache the result if it is called often.
+ *
+ * @return HUFF_CPU_* flags
+ */
+HUFF_INLINE
+unsigned
+huff_cpu_features(void) {
+  unsigned f = 0;
+#ifdef HUFF_CPU_X86
+  unsigned r[4], maxleaf;
+  uint64_t xcr0;
+
+  huff_cpuid(0, 0, r);
+  maxleaf = r[0];
+
+  huff_cpuid(1, 0, r);
+  if (r[3] & (1U << 26)) f |= HUFF_CPU_SSE2;
+  if (r[2] & (1U << 20)) f |= HUFF_CPU_SSE42;
+
+  /* OSXSAVE and AVX */
+  xcr0 = 0;
+  if ((r[2] & (3U << 27)) == (3U << 27))
+    xcr0 = huff_xgetbv();
+
+  if (maxleaf >= 7) {
+    huff_cpuid(7, 0, r);
+    if (r[1] & (1U << 3))
+      f |= HUFF_CPU_BMI1;
+    if (r[1] & (1U << 8))
+      f |= HUFF_CPU_BMI2;
+    if ((r[1] & (1U << 5)) && (xcr0 & 0x6) == 0x6)
+      f |= HUFF_CPU_AVX2;
+    if ((r[1] & (1U << 16)) && (r[1] & (1U << 30)) && (xcr0 & 0xE6) == 0xE6)
+      f |= HUFF_CPU_AVX512;
+  }
+
+  /* LZCNT (ABM) is in the extended leaves */
+  huff_cpuid(0x80000000U, 0, r);
+  if (r[0] >= 0x80000001U) {
+    huff_cpuid(0x80000001U, 0, r);
+    if (r[2] & (1U << 5))
+      f |= HUFF_CPU_LZCNT;
+  }
+#elif defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64)
+  f |= HUFF_CPU_NEON;
+#endif
+  return f;
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* huff_cpu_h */
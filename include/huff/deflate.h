@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * constant tables of DEFLATE (RFC 1951) fixed Huffman codes (BTYPE=01), they
+ * are in read-only memory and can be shared by all threads without building
+ * a table per stream. fixed codes are not longer than 9 bits so there are no
+ * sub tables, tables work with any HUFF_FAST_TABLE_BITS.
+ *
+ * tables are generated by scripts/deflate_table.c from the extras below.
+ */
+
+#ifndef huff_deflate_h
+#define huff_deflate_h
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "huff.h"
+
+#define HUFF_DEFLATE_LITLEN_OFFSET  257
+#define HUFF_DEFLATE_FIXED_LITLEN   288
+#define HUFF_DEFLATE_FIXED_DIST     30
+
+/*
+ * length codes 257..285, 286 and 287 can't occur in valid streams, they have
+ * no extra bits here and must be rejected by caller
+ */
+static const huff_ext_t huff_deflate_len_extras[31] = {
+  {  3,0,0x00}, {  4,0,0x00}, {  5,0,0x00}, {  6,0,0x00}, {  7,0,0x00},
+  {  8,0,0x00}, {  9,0,0x00}, { 10,0,0x00}, { 11,1,0x01}, { 13,1,0x01},
+  { 15,1,0x01}, { 17,1,0x01}, { 19,2,0x03}, { 23,2,0x03}, { 27,2,0x03},
+  { 31,2,0x03}, { 35,3,0x07}, { 43,3,0x07}, { 51,3,0x07}, { 59,3,0x07},
+  { 67,4,0x0f}, { 83,4,0x0f}, { 99,4,0x0f}, {115,4,0x0f}, {131,5,0x1f},
+  {163,5,0x1f}, {195,5,0x1f}, {227,5,0x1f}, {258,0,0x00}, {  0,0,0x00},
+  {  0,0,0x00}
+};
+
+/* distance codes 0..29 */
+static const huff_ext_t huff_deflate_dist_extras[30] = {
+  {    1, 0,0x0000}, {    2, 0,0x0000}, {    3, 0,0x0000}, {    4, 0,0x0000},
+  {    5, 1,0x0001}, {    7, 1,0x0001}, {    9, 2,0x0003}, {   13, 2,0x0003},
+  {   17, 3,0x0007}, {   25, 3,0x0007}, {   33, 4,0x000f}, {   49, 4,0x000f},
+  {   65, 5,0x001f}, {   97, 5,0x001f}, {  129, 6,0x003f}, {  193, 6,0x003f},
+  {  257, 7,0x007f}, {  385, 7,0x007f}, {  513, 8,0x00ff}, {  769, 8,0x00ff},
+  { 1025, 9,0x01ff}, { 1537, 9,0x01ff}, { 2049,10,0x03ff}, { 3073,10,0x03ff},
+  { 4097,11,0x07ff}, { 6145,11,0x07ff}, { 8193,12,0x0fff}, {12289,12,0x0fff},
+  {16385,13,0x1fff}, {24577,13,0x1fff}
+};
+
+#ifndef HUFF_DEFLATE_GEN
+/* generated by scripts/deflate_table.c */
+static const huff_table_ext_t huff_deflate_fixed_litlen = {
+  /* sentinels */
+  {{
+    0,0,0,0,0,0,0,24,200,512,1024,2048,
+    4096,8192,16384,32768
+  }},
+  /* offsets */
+  {{
+    0,0,0,0,0,0,0,0,65512,65312,64800,63776,
+    61728,57632,49440,33056,288
+  }},
+  huff_deflate_len_extras,  /* extras */
+  257,                      /* offset */
+  512,                      /* nfast  */
+  9,                        /* bits   */
+  /* fast */
+  {
+    {7,0,256,0,0,7},{8,0,80,0,0,8},{8,0,16,0,0,8},{8,0,280,115,4,12},{7,0,272,31,2,9},
+    {8,0,112,0,0,8},{8,0,48,0,0,8},{9,0,192,0,0,9},{7,0,264,10,0,7},{8,0,96,0,0,8},
+    {8,0,32,0,0,8},{9,0,160,0,0,9},{8,0,0,0,0,8},{8,0,128,0,0,8},{8,0,64,0,0,8},
+    {9,0,224,0,0,9},{7,0,260,6,0,7},{8,0,88,0,0,8},{8,0,24,0,0,8},{9,0,144,0,0,9},
+    {7,0,276,59,3,10},{8,0,120,0,0,8},{8,0,56,0,0,8},{9,0,208,0,0,9},{7,0,268,17,1,8},
+    {8,0,104,0,0,8},{8,0,40,0,0,8},{9,0,176,0,0,9},{8,0,8,0,0,8},{8,0,136,0,0,8},
+    {8,0,72,0,0,8},{9,0,240,0,0,9},{7,0,258,4,0,7},{8,0,84,0,0,8},{8,0,20,0,0,8},
+    {8,0,284,227,5,13},{7,0,274,43,3,10},{8,0,116,0,0,8},{8,0,52,0,0,8},{9,0,200,0,0,9},
+    {7,0,266,13,1,8},{8,0,100,0,0,8},{8,0,36,0,0,8},{9,0,168,0,0,9},{8,0,4,0,0,8},
+    {8,0,132,0,0,8},{8,0,68,0,0,8},{9,0,232,0,0,9},{7,0,262,8,0,7},{8,0,92,0,0,8},
+    {8,0,28,0,0,8},{9,0,152,0,0,9},{7,0,278,83,4,11},{8,0,124,0,0,8},{8,0,60,0,0,8},
+    {9,0,216,0,0,9},{7,0,270,23,2,9},{8,0,108,0,0,8},{8,0,44,0,0,8},{9,0,184,0,0,9},
+    {8,0,12,0,0,8},{8,0,140,0,0,8},{8,0,76,0,0,8},{9,0,248,0,0,9},{7,0,257,3,0,7},
+    {8,0,82,0,0,8},{8,0,18,0,0,8},{8,0,282,163,5,13},{7,0,273,35,3,10},{8,0,114,0,0,8},
+    {8,0,50,0,0,8},{9,0,196,0,0,9},{7,0,265,11,1,8},{8,0,98,0,0,8},{8,0,34,0,0,8},
+    {9,0,164,0,0,9},{8,0,2,0,0,8},{8,0,130,0,0,8},{8,0,66,0,0,8},{9,0,228,0,0,9},
+    {7,0,261,7,0,7},{8,0,90,0,0,8},{8,0,26,0,0,8},{9,0,148,0,0,9},{7,0,277,67,4,11},
+    {8,0,122,0,0,8},{8,0,58,0,0,8},{9,0,212,0,0,9},{7,0,269,19,2,9},{8,0,106,0,0,8},
+    {8,0,42,0,0,8},{9,0,180,0,0,9},{8,0,10,0,0,8},{8,0,138,0,0,8},{8,0,74,0,0,8},
+    {9,0,244,0,0,9},{7,0,259,5,0,7},{8,0,86,0,0,8},{8,0,22,0,0,8},{8,0,286,0,0,8},
+    {7,0,275,51,3,10},{8,0,118,0,0,8},{8,0,54,0,0,8},{9,0,204,0,0,9},{7,0,267,15,1,8},
+    {8,0,102,0,0,8},{8,0,38,0,0,8},{9,0,172,0,0,9},{8,0,6,0,0,8},{8,0,134,0,0,8},
+    {8,0,70,0,0,8},{9,0,236,0,0,9},{7,0,263,9,0,7},{8,0,94,0,0,8},{8,0,30,0,0,8},
+    {9,0,156,0,0,9},{7,0,279,99,4,11},{8,0,126,0,0,8},{8,0,62,0,0,8},{9,0,220,0,0,9},
+    {7,0,271,27,2,9},{8,0,110,0,0,8},{8,0,46,0,0,8},{9,0,188,0,0,9},{8,0,14,0,0,8},
+    {8,0,142,0,0,8},{8,0,78,0,0,8},{9,0,252,0,0,9},{7,0,256,0,0,7},{8,0,81,0,0,8},
+    {8,0,17,0,0,8},{8,0,281,131,5,13},{7,0,272,31,2,9},{8,0,113,0,0,8},{8,0,49,0,0,8},
+    {9,0,194,0,0,9},{7,0,264,10,0,7},{8,0,97,0,0,8},{8,0,33,0,0,8},{9,0,162,0,0,9},
+    {8,0,1,0,0,8},{8,0,129,0,0,8},{8,0,65,0,0,8},{9,0,226,0,0,9},{7,0,260,6,0,7},
+    {8,0,89,0,0,8},{8,0,25,0,0,8},{9,0,146,0,0,9},{7,0,276,59,3,10},{8,0,121,0,0,8},
+    {8,0,57,0,0,8},{9,0,210,0,0,9},{7,0,268,17,1,8},{8,0,105,0,0,8},{8,0,41,0,0,8},
+    {9,0,178,0,0,9},{8,0,9,0,0,8},{8,0,137,0,0,8},{8,0,73,0,0,8},{9,0,242,0,0,9},
+    {7,0,258,4,0,7},{8,0,85,0,0,8},{8,0,21,0,0,8},{8,0,285,258,0,8},{7,0,274,43,3,10},
+    {8,0,117,0,0,8},{8,0,53,0,0,8},{9,0,202,0,0,9},{7,0,266,13,1,8},{8,0,101,0,0,8},
+    {8,0,37,0,0,8},{9,0,170,0,0,9},{8,0,5,0,0,8},{8,0,133,0,0,8},{8,0,69,0,0,8},
+    {9,0,234,0,0,9},{7,0,262,8,0,7},{8,0,93,0,0,8},{8,0,29,0,0,8},{9,0,154,0,0,9},
+    {7,0,278,83,4,11},{8,0,125,0,0,8},{8,0,61,0,0,8},{9,0,218,0,0,9},{7,0,270,23,2,9},
+    {8,0,109,0,0,8},{8,0,45,0,0,8},{9,0,186,0,0,9},{8,0,13,0,0,8},{8,0,141,0,0,8},
+    {8,0,77,0,0,8},{9,0,250,0,0,9},{7,0,257,3,0,7},{8,0,83,0,0,8},{8,0,19,0,0,8},
+    {8,0,283,195,5,13},{7,0,273,35,3,10},{8,0,115,0,0,8},{8,0,51,0,0,8},{9,0,198,0,0,9},
+    {7,0,265,11,1,8},{8,0,99,0,0,8},{8,0,35,0,0,8},{9,0,166,0,0,9},{8,0,3,0,0,8},
+    {8,0,131,0,0,8},{8,0,67,0,0,8},{9,0,230,0,0,9},{7,0,261,7,0,7},{8,0,91,0,0,8},
+    {8,0,27,0,0,8},{9,0,150,0,0,9},{7,0,277,67,4,11},{8,0,123,0,0,8},{8,0,59,0,0,8},
+    {9,0,214,0,0,9},{7,0,269,19,2,9},{8,0,107,0,0,8},{8,0,43,0,0,8},{9,0,182,0,0,9},
+    {8,0,11,0,0,8},{8,0,139,0,0,8},{8,0,75,0,0,8},{9,0,246,0,0,9},{7,0,259,5,0,7},
+    {8,0,87,0,0,8},{8,0,23,0,0,8},{8,0,287,0,0,8},{7,0,275,51,3,10},{8,0,119,0,0,8},
+    {8,0,55,0,0,8},{9,0,206,0,0,9},{7,0,267,15,1,8},{8,0,103,0,0,8},{8,0,39,0,0,8},
+    {9,0,174,0,0,9},{8,0,7,0,0,8},{8,0,135,0,0,8},{8,0,71,0,0,8},{9,0,238,0,0,9},
+    {7,0,263,9,0,7},{8,0,95,0,0,8},{8,0,31,0,0,8},{9,0,158,0,0,9},{7,0,279,99,4,11},
+    {8,0,127,0,0,8},{8,0,63,0,0,8},{9,0,222,0,0,9},{7,0,271,27,2,9},{8,0,111,0,0,8},
+    {8,0,47,0,0,8},{9,0,190,0,0,9},{8,0,15,0,0,8},{8,0,143,0,0,8},{8,0,79,0,0,8},
+    {9,0,254,0,0,9},{7,0,256,0,0,7},{8,0,80,0,0,8},{8,0,16,0,0,8},{8,0,280,115,4,12},
+    {7,0,272,31,2,9},{8,0,112,0,0,8},{8,0,48,0,0,8},{9,0,193,0,0,9},{7,0,264,10,0,7},
+    {8,0,96,0,0,8},{8,0,32,0,0,8},{9,0,161,0,0,9},{8,0,0,0,0,8},{8,0,128,0,0,8},
+    {8,0,64,0,0,8},{9,0,225,0,0,9},{7,0,260,6,0,7},{8,0,88,0,0,8},{8,0,24,0,0,8},
+    {9,0,145,0,0,9},{7,0,276,59,3,10},{8,0,120,0,0,8},{8,0,56,0,0,8},{9,0,209,0,0,9},
+    {7,0,268,17,1,8},{8,0,104,0,0,8},{8,0,40,0,0,8},{9,0,177,0,0,9},{8,0,8,0,0,8},
+    {8,0,136,0,0,8},{8,0,72,0,0,8},{9,0,241,0,0,9},{7,0,258,4,0,7},{8,0,84,0,0,8},
+    {8,0,20,0,0,8},{8,0,284,227,5,13},{7,0,274,43,3,10},{8,0,116,0,0,8},{8,0,52,0,0,8},
+    {9,0,201,0,0,9},{7,0,266,13,1,8},{8,0,100,0,0,8},{8,0,36,0,0,8},{9,0,169,0,0,9},
+    {8,0,4,0,0,8},{8,0,132,0,0,8},{8,0,68,0,0,8},{9,0,233,0,0,9},{7,0,262,8,0,7},
+    {8,0,92,0,0,8},{8,0,28,0,0,8},{9,0,153,0,0,9},{7,0,278,83,4,11},{8,0,124,0,0,8},
+    {8,0,60,0,0,8},{9,0,217,0,0,9},{7,0,270,23,2,9},{8,0,108,0,0,8},{8,0,44,0,0,8},
+    {9,0,185,0,0,9},{8,0,12,0,0,8},{8,0,140,0,0,8},{8,0,76,0,0,8},{9,0,249,0,0,9},
+    {7,0,257,3,0,7},{8,0,82,0,0,8},{8,0,18,0,0,8},{8,0,282,163,5,13},{7,0,273,35,3,10},
+    {8,0,114,0,0,8},{8,0,50,0,0,8},{9,0,197,0,0,9},{7,0,265,11,1,8},{8,0,98,0,0,8},
+    {8,0,34,0,0,8},{9,0,165,0,0,9},{8,0,2,0,0,8},{8,0,130,0,0,8},{8,0,66,0,0,8},
+    {9,0,229,0,0,9},{7,0,261,7,0,7},{8,0,90,0,0,8},{8,0,26,0,0,8},{9,0,149,0,0,9},
+    {7,0,277,67,4,11},{8,0,122,0,0,8},{8,0,58,0,0,8},{9,0,213,0,0,9},{7,0,269,19,2,9},
+    {8,0,106,0,0,8},{8,0,42,0,0,8},{9,0,181,0,0,9},{8,0,10,0,0,8},{8,0,138,0,0,8},
+    {8,0,74,0,0,8},{9,0,245,0,0,9},{7,0,259,5,0,7},{8,0,86,0,0,8},{8,0,22,0,0,8},
+    {8,0,286,0,0,8},{7,0,275,51,3,10},{8,0,118,0,0,8},{8,0,54,0,0,8},{9,0,205,0,0,9},
+    {7,0,267,15,1,8},{8,0,102,0,0,8},{8,0,38,0,0,8},{9,0,173,0,0,9},{8,0,6,0,0,8},
+    {8,0,134,0,0,8},{8,0,70,0,0,8},{9,0,237,0,0,9},{7,0,263,9,0,7},{8,0,94,0,0,8},
+    {8,0,30,0,0,8},{9,0,157,0,0,9},{7,0,279,99,4,11},{8,0,126,0,0,8},{8,0,62,0,0,8},
+    {9,0,221,0,0,9},{7,0,271,27,2,9},{8,0,110,0,0,8},{8,0,46,0,0,8},{9,0,189,0,0,9},
+    {8,0,14,0,0,8},{8,0,142,0,0,8},{8,0,78,0,0,8},{9,0,253,0,0,9},{7,0,256,0,0,7},
+    {8,0,81,0,0,8},{8,0,17,0,0,8},{8,0,281,131,5,13},{7,0,272,31,2,9},{8,0,113,0,0,8},
+    {8,0,49,0,0,8},{9,0,195,0,0,9},{7,0,264,10,0,7},{8,0,97,0,0,8},{8,0,33,0,0,8},
+    {9,0,163,0,0,9},{8,0,1,0,0,8},{8,0,129,0,0,8},{8,0,65,0,0,8},{9,0,227,0,0,9},
+    {7,0,260,6,0,7},{8,0,89,0,0,8},{8,0,25,0,0,8},{9,0,147,0,0,9},{7,0,276,59,3,10},
+    {8,0,121,0,0,8},{8,0,57,0,0,8},{9,0,211,0,0,9},{7,0,268,17,1,8},{8,0,105,0,0,8},
+    {8,0,41,0,0,8},{9,0,179,0,0,9},{8,0,9,0,0,8},{8,0,137,0,0,8},{8,0,73,0,0,8},
+    {9,0,243,0,0,9},{7,0,258,4,0,7},{8,0,85,0,0,8},{8,0,21,0,0,8},{8,0,285,258,0,8},
+    {7,0,274,43,3,10},{8,0,117,0,0,8},{8,0,53,0,0,8},{9,0,203,0,0,9},{7,0,266,13,1,8},
+    {8,0,101,0,0,8},{8,0,37,0,0,8},{9,0,171,0,0,9},{8,0,5,0,0,8},{8,0,133,0,0,8},
+    {8,0,69,0,0,8},{9,0,235,0,0,9},{7,0,262,8,0,7},{8,0,93,0,0,8},{8,0,29,0,0,8},
+    {9,0,155,0,0,9},{7,0,278,83,4,11},{8,0,125,0,0,8},{8,0,61,0,0,8},{9,0,219,0,0,9},
+    {7,0,270,23,2,9},{8,0,109,0,0,8},{8,0,45,0,0,8},{9,0,187,0,0,9},{8,0,13,0,0,8},
+    {8,0,141,0,0,8},{8,0,77,0,0,8},{9,0,251,0,0,9},{7,0,257,3,0,7},{8,0,83,0,0,8},
+    {8,0,19,0,0,8},{8,0,283,195,5,13},{7,0,273,35,3,10},{8,0,115,0,0,8},{8,0,51,0,0,8},
+    {9,0,199,0,0,9},{7,0,265,11,1,8},{8,0,99,0,0,8},{8,0,35,0,0,8},{9,0,167,0,0,9},
+    {8,0,3,0,0,8},{8,0,131,0,0,8},{8,0,67,0,0,8},{9,0,231,0,0,9},{7,0,261,7,0,7},
+    {8,0,91,0,0,8},{8,0,27,0,0,8},{9,0,151,0,0,9},{7,0,277,67,4,11},{8,0,123,0,0,8},
+    {8,0,59,0,0,8},{9,0,215,0,0,9},{7,0,269,19,2,9},{8,0,107,0,0,8},{8,0,43,0,0,8},
+    {9,0,183,0,0,9},{8,0,11,0,0,8},{8,0,139,0,0,8},{8,0,75,0,0,8},{9,0,247,0,0,9},
+    {7,0,259,5,0,7},{8,0,87,0,0,8},{8,0,23,0,0,8},{8,0,287,0,0,8},{7,0,275,51,3,10},
+    {8,0,119,0,0,8},{8,0,55,0,0,8},{9,0,207,0,0,9},{7,0,267,15,1,8},{8,0,103,0,0,8},
+    {8,0,39,0,0,8},{9,0,175,0,0,9},{8,0,7,0,0,8},{8,0,135,0,0,8},{8,0,71,0,0,8},
+    {9,0,239,0,0,9},{7,0,263,9,0,7},{8,0,95,0,0,8},{8,0,31,0,0,8},{9,0,159,0,0,9},
+    {7,0,279,99,4,11},{8,0,127,0,0,8},{8,0,63,0,0,8},{9,0,223,0,0,9},{7,0,271,27,2,9},
+    {8,0,111,0,0,8},{8,0,47,0,0,8},{9,0,191,0,0,9},{8,0,15,0,0,8},{8,0,143,0,0,8},
+    {8,0,79,0,0,8},{9,0,255,0,0,9}
+  }
+};
+
+static const huff_table_ext_t huff_deflate_fixed_dist = {
+  /* sentinels */
+  {{
+    0,0,0,0,0,30,60,120,240,480,960,1920,
+    3840,7680,15360,30720,61440
+  }},
+  /* offsets */
+  {{
+    0,0,0,0,0,0,65506,65446,65326,65086,64606,63646,
+    61726,57886,50206,34846,4126
+  }},
+  huff_deflate_dist_extras, /* extras */
+  0,                        /* offset */
+  32,                       /* nfast  */
+  5,                        /* bits   */
+  /* fast */
+  {
+    {5,0,0,1,0,5},{5,0,16,257,7,12},{5,0,8,17,3,8},{5,0,24,4097,11,16},{5,0,4,5,1,6},
+    {5,0,20,1025,9,14},{5,0,12,65,5,10},{5,0,28,16385,13,18},{5,0,2,3,0,5},{5,0,18,513,8,13},
+    {5,0,10,33,4,9},{5,0,26,8193,12,17},{5,0,6,9,2,7},{5,0,22,2049,10,15},{5,0,14,129,6,11},
+    {0,0,0,0,0,0},{5,0,1,2,0,5},{5,0,17,385,7,12},{5,0,9,25,3,8},{5,0,25,6145,11,16},
+    {5,0,5,7,1,6},{5,0,21,1537,9,14},{5,0,13,97,5,10},{5,0,29,24577,13,18},{5,0,3,4,0,5},
+    {5,0,19,769,8,13},{5,0,11,49,4,9},{5,0,27,12289,12,17},{5,0,7,13,2,7},{5,0,23,3073,10,15},
+    {5,0,15,193,6,11},{0,0,0,0,0,0}
+  }
+};
+
+#endif /* HUFF_DEFLATE_GEN */
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* huff_deflate_h */
@@ -0,0 +1,428 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef huff_encode_h
+#define huff_encode_h
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct huff_sym_freq_t {
+  uint32_t freq; /* frequency, then code length after huff_build_lengths()  */
+  uint16_t sym;
+} huff_sym_freq_t;
+
+static inline
+int
+huff_sym_freq_cmp(const void *a, const void *b) {
+  const huff_sym_freq_t *x = (const huff_sym_freq_t *)a,
+                        *y = (const huff_sym_freq_t *)b;
+  if (x->freq != y->freq) return x->freq < y->freq ? -1 : 1;
+  return (int)x->sym - (int)y->sym;
+}
+
+/*!
+ * @brief Builds code lengths limited to `max_len` from symbol frequencies.
+ *
+ * Lengths are computed with the in-place algorithm of Moffat and Katajainen,
+ * then codes longer than `max_len` are shortened and Kraft sum is fixed by
+ * moving shorter codes down (as in miniz). The result is a complete code
+ * unless only one symbol is used, it gets length 1.
+ *
+ * @param[in]  freqs    Frequency of each symbol, 0 for unused symbols.
+ * @param[in]  n        Number of symbols, up to `HUFF_MAX_CODES`.
+ * @param[in]  max_len  Max code length, up to `HUFF_MAX_CODE_LENGTH`.
+ * @param[out] lengths  Code length of each symbol, 0 for unused symbols.
+ *
+ * @return `false` if `n` or `max_len` is out of range or `max_len` is too
+ *         small for the number of used symbols.
+ */
+HUFF_INLINE
+bool
+huff_build_lengths(const uint32_t * __restrict freqs,
+                   uint16_t                    n,
+                   uint8_t                     max_len,
+                   uint8_t        * __restrict lengths) {
+  huff_sym_freq_t A[HUFF_MAX_CODES];
+  uint_fast32_t   total, num[HUFF_MAX_CODE_LENGTH + 1] = {0};
+  int             m, i, j, root, leaf, next, avbl, used, dpth;
+
+  if (n > HUFF_MAX_CODES || !max_len || max_len > HUFF_MAX_CODE_LENGTH)
+    return false;
+
+  for (i = m = 0; i < n; i++) {
+    lengths[i] = 0;
+    if (freqs[i]) {
+      A[m].freq  = freqs[i];
+      A[m++].sym = (uint16_t)i;
+    }
+  }
+
+  if (m == 0) return true;
+  if (m == 1) { lengths[A[0].sym] = 1; return true; }
+  if (m > (1 << max_len)) return false;
+
+  qsort(A, (size_t)m, sizeof(A[0]), huff_sym_freq_cmp);
+
+  /* in-place minimum redundancy code lengths, A[i].freq becomes length */
+  A[0].freq += A[1].freq;
+  root       = 0;
+  leaf       = 2;
+
+  for (next = 1; next < m - 1; next++) {
+    if (leaf >= m || A[root].freq < A[leaf].freq) {
+      A[next].freq   = A[root].freq;
+      A[root++].freq = (uint32_t)next;
+    } else {
+      A[next].freq   = A[leaf++].freq;
+    }
+
+    if (leaf >= m || (root < next && A[root].freq < A[leaf].freq)) {
+      A[next].freq  += A[root].freq;
+      A[root++].freq = (uint32_t)next;
+    } else {
+      A[next].freq  += A[leaf++].freq;
+    }
+  }
+
+  A[m - 2].freq = 0;
+  for (next = m - 3; next >= 0; next--)
+    A[next].freq = A[A[next].freq].freq + 1;
+
+  avbl = 1;
+  used = dpth = 0;
+  root = m - 2;
+  next = m - 1;
+
+  while (avbl > 0) {
+    while (root >= 0 && (int)A[root].freq == dpth) { used++; root--; }
+    while (avbl > used) { A[next--].freq = (uint32_t)dpth; avbl--; }
+    avbl = 2 * used;
+    dpth++;
+    used = 0;
+  }
+
+  /* limit lengths, count longer codes as max_len then fix Kraft sum */
+  for (i = 0; i < m; i++)
+    num[A[i].freq < max_len ? A[i].freq : max_len]++;
+
+  for (i = max_len, total = 0; i > 0; i--)
+    total += num[i] << (max_len - i);
+
+  while (total != (1UL << max_len)) {
+    num[max_len]--;
+    for (i = max_len - 1; i > 0; i--) {
+      if (num[i]) {
+        num[i]--;
+        num[i + 1] += 2;
+        break;
+      }
+    }
+    total--;
+  }
+
+  /* least frequent symbols get longest codes */
+  for (i = max_len, j = 0; i > 0; i--)
+    for (total = num[i]; total > 0; total--)
+      lengths[A[j++].sym] = (uint8_t)i;
+
+  return true;
+}
+
+/*!
+ * @brief Assigns canonical codes in the same order as table builders.
+ *
+ * @param[in]  lengths  Code length of each symbol, 0 for unused symbols.
+ * @param[in]  n        Number of symbols.
+ * @param[out] codes    Code of each symbol, MSB-first (not reversed).
+ */
+HUFF_INLINE
+void
+huff_codes_msb(const uint8_t * __restrict lengths,
+               uint16_t                   n,
+               uint16_t      * __restrict codes) {
+  uint_fast16_t count[HUFF_MAX_CODE_LENGTH + 1] = {0};
+  uint_fast16_t next[HUFF_MAX_CODE_LENGTH  + 1];
+  uint_fast16_t l, i, code;
+
+  for (i = 0; i < n; i++)
+    count[lengths[i]]++;
+
+  count[0] = code = 0;
+  for (l = 1; l <= HUFF_MAX_CODE_LENGTH; l++) {
+    code    = (code + count[l - 1]) << 1;
+    next[l] = code;
+  }
+
+  for (i = 0; i < n; i++)
+    codes[i] = (l = lengths[i]) ? (uint16_t)next[l]++ : 0;
+}
+
+/*!
+ * @brief Assigns canonical codes for LSB-first streams, same as
+ *        `huff_codes_msb()` but codes are bit-reversed to be written as is.
+ */
+HUFF_INLINE
+void
+huff_codes_lsb(const uint8_t * __restrict lengths,
+               uint16_t                   n,
+               uint16_t      * __restrict codes) {
+  uint_fast16_t i;
+
+  huff_codes_msb(lengths, n, codes);
+
+  for (i = 0; i < n; i++)
+    if (lengths[i])
+      codes[i] = huff_rev16(codes[i], lengths[i]);
+}
+
+/*
+ * encoder table, mirrors the fast table of huff_table_t: one aligned 32 bit
+ * entry per symbol, code << 8 | len, is loaded with a single load. codes are
+ * bit-reversed in tables built by huff_init_enc_lsb(). unused symbols are 0.
+ */
+#define HUFF_ENC_CODE(e)      ((e) >> 8)
+#define HUFF_ENC_LEN(e)       ((e) & 0xFF)
+
+typedef struct huff_enc_table_t {
+  HUFF_ALIGN(32) uint32_t entry[HUFF_MAX_CODES];
+  uint16_t                n;      /* number of symbols                      */
+  uint8_t                 maxlen; /* longest code, sets codes per flush     */
+  uint8_t                 group;  /* codes put between two flushes          */
+} huff_enc_table_t;
+
+HUFF_INLINE
+bool
+huff_init_enc(huff_enc_table_t * __restrict enc,
+              const uint8_t    * __restrict lengths,
+              const uint16_t   * __restrict codes,
+              uint16_t                      n) {
+  uint_fast16_t i;
+  unsigned      maxlen;
+
+  /* failed init leaves a table which encodes nothing */
+  enc->n      = 0;
+  enc->maxlen = 0;
+  enc->group  = 0;
+
+  if (n > HUFF_MAX_CODES)
+    return false;
+
+  for (i = 0, maxlen = 0; i < n; i++) {
+    if (lengths[i] > HUFF_MAX_CODE_LENGTH)
+      return false;
+
+    enc->entry[i] = lengths[i] ? (uint32_t)codes[i] << 8 | lengths[i] : 0;
+    if (lengths[i] > maxlen)
+      maxlen = lengths[i];
+  }
+
+  /* at most 7 bits stay after flush, 7 + group * maxlen fit in 63 bits */
+  enc->n      = n;
+  enc->maxlen = (uint8_t)maxlen;
+  enc->group  = (uint8_t)(maxlen ? (63 - 7) / maxlen : 0);
+  return true;
+}
+
+/*!
+ * @brief Builds an encoder table for LSB-first streams from code lengths,
+ *        codes are assigned by `huff_codes_lsb()`.
+ *
+ * @return `false` if `n` or a length is out of range.
+ */
+HUFF_INLINE
+bool
+huff_init_enc_lsb(huff_enc_table_t * __restrict enc,
+                  const uint8_t    * __restrict lengths,
+                  uint16_t                      n) {
+  uint16_t codes[HUFF_MAX_CODES];
+
+  if (n > HUFF_MAX_CODES)
+    return false;
+
+  huff_codes_lsb(lengths, n, codes);
+  return huff_init_enc(enc, lengths, codes, n);
+}
+
+/*!
+ * @brief Builds an encoder table for MSB-first streams from code lengths,
+ *        codes are assigned by `huff_codes_msb()`.
+ *
+ * @return `false` if `n` or a length is out of range.
+ */
+HUFF_INLINE
+bool
+huff_init_enc_msb(huff_enc_table_t * __restrict enc,
+                  const uint8_t    * __restrict lengths,
+                  uint16_t                      n) {
+  uint16_t codes[HUFF_MAX_CODES];
+
+  if (n > HUFF_MAX_CODES)
+    return false;
+
+  huff_codes_msb(lengths, n, codes);
+  return huff_init_enc(enc, lengths, codes, n);
+}
+
+/*
+ * shared body of bulk encoders. while 8 bytes of output are left, group codes
+ * are put into local bits and stored with one 8 byte store, e.g. 7 codes per
+ * flush for 8 bit codes and 3 for 16 bit codes.
+ */
+HUFF_INLINE
+bool
+huff_encode_n(const huff_enc_table_t * __restrict enc,
+              const void             * __restrict in,
+              size_t                              n,
+              huff_writer_t          * __restrict writer,
+              bool                                wide,
+              bool                                msb) {
+  const uint16_t *in16;
+  const uint8_t  *in8;
+  uint8_t        *p;
+  uint64_t        bits;
+  size_t          i, j, group;
+  uint32_t        e;
+  unsigned        nbits;
+
+#define HUFF_ENC_SYM(k) (wide ? in16[k] : in8[k])
+#define HUFF_ENC_PUT(k)                                                       \
+  do {                                                                        \
+    e = enc->entry[HUFF_ENC_SYM(k)];                                          \
+    if (msb) {                                                                \
+      bits   = (bits << HUFF_ENC_LEN(e)) | HUFF_ENC_CODE(e);                  \
+    } else {                                                                  \
+      bits  |= (uint64_t)HUFF_ENC_CODE(e) << nbits;                        \
+    }                                                                         \
+    nbits += HUFF_ENC_LEN(e);                                                 \
+  } while (0)
+
+  in16  = (const uint16_t *)in;
+  in8   = (const uint8_t *)in;
+  group = enc->group;
+  i     = 0;
+
+  /* flush bits put by huff_writer_put_*() before */
+  if (unlikely(writer->nbits >= 8)
+      && !(msb ? huff_writer_flush_msb(writer) : huff_writer_flush_lsb(writer)))
+    return false;
+
+  if (likely(group >= 3)) {
+    p     = writer->p;
+    bits  = writer->bits;
+    nbits = writer->nbits;
+
+    while (n - i >= group && writer->end - p >= 8) {
+      if (group >= 4) {
+        HUFF_ENC_PUT(i);
+        HUFF_ENC_PUT(i + 1);
+        HUFF_ENC_PUT(i + 2);
+        HUFF_ENC_PUT(i + 3);
+        for (j = 4; j < group; j++)
+          HUFF_ENC_PUT(i + j);
+      } else {
+        HUFF_ENC_PUT(i);
+        HUFF_ENC_PUT(i + 1);
+        HUFF_ENC_PUT(i + 2);
+      }
+      i += group;
+
+      if (msb) {
+        huff_store64be(p, (bits << (63 - nbits)) << 1);
+      } else {
+        huff_store64le(p, bits);
+        bits >>= nbits & ~7U;
+      }
+      p     += nbits >> 3;
+      nbits &= 7;
+    }
+
+    writer->p     = p;
+    writer->bits  = bits;
+    writer->nbits = nbits;
+  }
+
+  /* near end of output: one code per flush */
+  for (; i < n; i++) {
+    e = enc->entry[HUFF_ENC_SYM(i)];
+    if (msb) {
+      huff_writer_put_msb(writer, HUFF_ENC_CODE(e), HUFF_ENC_LEN(e));
+      if (unlikely(!huff_writer_flush_msb(writer)))
+        return false;
+    } else {
+      huff_writer_put_lsb(writer, HUFF_ENC_CODE(e), HUFF_ENC_LEN(e));
+      if (unlikely(!huff_writer_flush_lsb(writer)))
+        return false;
+    }
+  }
+
+#undef HUFF_ENC_PUT
+#undef HUFF_ENC_SYM
+
+  return true;
+}
+
+/*!
+ * @brief Encodes `n` symbols to an LSB-first stream, bits are stored with one
+ *        8 byte store per group of codes instead of a flush per code.
+ *
+ * Pending bits are flushed, call `huff_writer_finish_lsb()` at end of stream.
+ *
+ * @param[in]      enc     Table built by `huff_init_enc_lsb()`.
+ * @param[in]      in      Symbols, each less than `enc->n`.
+ * @param[in]      n       Number of symbols.
+ * @param[in, out] writer  Writer, less than 8 bits may be pending.
+ *
+ * @return `false` if output is full.
+ */
+HUFF_INLINE
+bool
+huff_encode_lsb_n(const huff_enc_table_t * __restrict enc,
+                  const uint16_t         * __restrict in,
+                  size_t                              n,
+                  huff_writer_t          * __restrict writer) {
+  return huff_encode_n(enc, in, n, writer, true, false);
+}
+
+/*!
+ * @brief Same as `huff_encode_lsb_n()` for byte symbols e.g. text or logs.
+ */
+HUFF_INLINE
+bool
+huff_encode_lsb_bytes(const huff_enc_table_t * __restrict enc,
+                      const uint8_t          * __restrict in,
+                      size_t                              n,
+                      huff_writer_t          * __restrict writer) {
+  return huff_encode_n(enc, in, n, writer, false, false);
+}
+
+/*!
+ * @brief Same as `huff_encode_lsb_n()` for MSB-first streams, table is built
+ *        by `huff_init_enc_msb()`.
+ */
+HUFF_INLINE
+bool
+huff_encode_msb_n(const huff_enc_table_t * __restrict enc,
+                  const uint16_t         * __restrict in,
+                  size_t                              n,
+                  huff_writer_t          * __restrict writer) {
+  return huff_encode_n(enc, in, n, writer, true, true);
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* huff_encode_h */
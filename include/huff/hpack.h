@@ -0,0 +1,734 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * HPACK / QPACK static Huffman code (RFC 7541 Appendix B). The code is fixed,
+ * tables below are constant and generated by scripts/hpack_table.py, nothing
+ * is built at runtime. Codes are MSB-first and up to 30 bits long.
+ *
+ * Decoder looks up HUFF_HPACK_FAST_BITS at a time, entry of a lookup holds
+ * one or two symbols so common 5-6 bit symbols are emitted in pairs. Longer
+ * codes are resolved with canonical limits.
+ */
+
+#ifndef huff_hpack_h
+#define huff_hpack_h
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "huff.h"
+
+#define HUFF_HPACK_SYMS        257 /* 256 octets + EOS                      */
+#define HUFF_HPACK_EOS         256
+#define HUFF_HPACK_MAX_LENGTH  30
+#define HUFF_HPACK_FAST_BITS   11
+
+typedef struct huff_hpack_entry_t {
+  uint8_t len1;   /* length of first code, 0 if longer than fast bits      */
+  uint8_t len;    /* length of both codes, same as len1 for one symbol     */
+  uint8_t sym[2];
+} huff_hpack_entry_t;
+
+/* generated by scripts/hpack_table.py */
+static const uint32_t huff_hpack_codes[HUFF_HPACK_SYMS] = {
+  0x00001ff8,0x007fffd8,0x0fffffe2,0x0fffffe3,0x0fffffe4,0x0fffffe5,0x0fffffe6,0x0fffffe7,
+  0x0fffffe8,0x00ffffea,0x3ffffffc,0x0fffffe9,0x0fffffea,0x3ffffffd,0x0fffffeb,0x0fffffec,
+  0x0fffffed,0x0fffffee,0x0fffffef,0x0ffffff0,0x0ffffff1,0x0ffffff2,0x3ffffffe,0x0ffffff3,
+  0x0ffffff4,0x0ffffff5,0x0ffffff6,0x0ffffff7,0x0ffffff8,0x0ffffff9,0x0ffffffa,0x0ffffffb,
+  0x00000014,0x000003f8,0x000003f9,0x00000ffa,0x00001ff9,0x00000015,0x000000f8,0x000007fa,
+  0x000003fa,0x000003fb,0x000000f9,0x000007fb,0x000000fa,0x00000016,0x00000017,0x00000018,
+  0x00000000,0x00000001,0x00000002,0x00000019,0x0000001a,0x0000001b,0x0000001c,0x0000001d,
+  0x0000001e,0x0000001f,0x0000005c,0x000000fb,0x00007ffc,0x00000020,0x00000ffb,0x000003fc,
+  0x00001ffa,0x00000021,0x0000005d,0x0000005e,0x0000005f,0x00000060,0x00000061,0x00000062,
+  0x00000063,0x00000064,0x00000065,0x00000066,0x00000067,0x00000068,0x00000069,0x0000006a,
+  0x0000006b,0x0000006c,0x0000006d,0x0000006e,0x0000006f,0x00000070,0x00000071,0x00000072,
+  0x000000fc,0x00000073,0x000000fd,0x00001ffb,0x0007fff0,0x00001ffc,0x00003ffc,0x00000022,
+  0x00007ffd,0x00000003,0x00000023,0x00000004,0x00000024,0x00000005,0x00000025,0x00000026,
+  0x00000027,0x00000006,0x00000074,0x00000075,0x00000028,0x00000029,0x0000002a,0x00000007,
+  0x0000002b,0x00000076,0x0000002c,0x00000008,0x00000009,0x0000002d,0x00000077,0x00000078,
+  0x00000079,0x0000007a,0x0000007b,0x00007ffe,0x000007fc,0x00003ffd,0x00001ffd,0x0ffffffc,
+  0x000fffe6,0x003fffd2,0x000fffe7,0x000fffe8,0x003fffd3,0x003fffd4,0x003fffd5,0x007fffd9,
+  0x003fffd6,0x007fffda,0x007fffdb,0x007fffdc,0x007fffdd,0x007fffde,0x00ffffeb,0x007fffdf,
+  0x00ffffec,0x00ffffed,0x003fffd7,0x007fffe0,0x00ffffee,0x007fffe1,0x007fffe2,0x007fffe3,
+  0x007fffe4,0x001fffdc,0x003fffd8,0x007fffe5,0x003fffd9,0x007fffe6,0x007fffe7,0x00ffffef,
+  0x003fffda,0x001fffdd,0x000fffe9,0x003fffdb,0x003fffdc,0x007fffe8,0x007fffe9,0x001fffde,
+  0x007fffea,0x003fffdd,0x003fffde,0x00fffff0,0x001fffdf,0x003fffdf,0x007fffeb,0x007fffec,
+  0x001fffe0,0x001fffe1,0x003fffe0,0x001fffe2,0x007fffed,0x003fffe1,0x007fffee,0x007fffef,
+  0x000fffea,0x003fffe2,0x003fffe3,0x003fffe4,0x007ffff0,0x003fffe5,0x003fffe6,0x007ffff1,
+  0x03ffffe0,0x03ffffe1,0x000fffeb,0x0007fff1,0x003fffe7,0x007ffff2,0x003fffe8,0x01ffffec,
+  0x03ffffe2,0x03ffffe3,0x03ffffe4,0x07ffffde,0x07ffffdf,0x03ffffe5,0x00fffff1,0x01ffffed,
+  0x0007fff2,0x001fffe3,0x03ffffe6,0x07ffffe0,0x07ffffe1,0x03ffffe7,0x07ffffe2,0x00fffff2,
+  0x001fffe4,0x001fffe5,0x03ffffe8,0x03ffffe9,0x0ffffffd,0x07ffffe3,0x07ffffe4,0x07ffffe5,
+  0x000fffec,0x00fffff3,0x000fffed,0x001fffe6,0x003fffe9,0x001fffe7,0x001fffe8,0x007ffff3,
+  0x003fffea,0x003fffeb,0x01ffffee,0x01ffffef,0x00fffff4,0x00fffff5,0x03ffffea,0x007ffff4,
+  0x03ffffeb,0x07ffffe6,0x03ffffec,0x03ffffed,0x07ffffe7,0x07ffffe8,0x07ffffe9,0x07ffffea,
+  0x07ffffeb,0x0ffffffe,0x07ffffec,0x07ffffed,0x07ffffee,0x07ffffef,0x07fffff0,0x03ffffee,
+  0x3fffffff
+};
+
+static const uint8_t huff_hpack_lengths[HUFF_HPACK_SYMS] = {
+  13,23,28,28,28,28,28,28,28,24,30,28,28,30,28,28,
+  28,28,28,28,28,28,30,28,28,28,28,28,28,28,28,28,
+   6,10,10,12,13, 6, 8,11,10,10, 8,11, 8, 6, 6, 6,
+   5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 7, 8,15, 6,12,10,
+  13, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+   7, 7, 7, 7, 7, 7, 7, 7, 8, 7, 8,13,19,13,14, 6,
+  15, 5, 6, 5, 6, 5, 6, 6, 6, 5, 7, 7, 6, 6, 6, 5,
+   6, 7, 6, 5, 5, 6, 7, 7, 7, 7, 7,15,11,14,13,28,
+  20,22,20,20,22,22,22,23,22,23,23,23,23,23,24,23,
+  24,24,22,23,24,23,23,23,23,21,22,23,22,23,23,24,
+  22,21,20,22,22,23,23,21,23,22,22,24,21,22,23,23,
+  21,21,22,21,23,22,23,23,20,22,22,22,23,22,22,23,
+  26,26,20,19,22,23,22,25,26,26,26,27,27,26,24,25,
+  19,21,26,27,27,26,27,24,21,21,26,26,28,27,27,27,
+  20,24,20,21,22,21,21,23,22,22,25,25,24,24,26,23,
+  26,27,26,26,27,27,27,27,27,28,27,27,27,27,27,26,
+  30
+};
+
+static const huff_hpack_entry_t huff_hpack_fast[1 << HUFF_HPACK_FAST_BITS] = {
+  { 5,10,{ 48, 48}},{ 5,10,{ 48, 48}},{ 5,10,{ 48, 49}},{ 5,10,{ 48, 49}},{ 5,10,{ 48, 50}},
+  { 5,10,{ 48, 50}},{ 5,10,{ 48, 97}},{ 5,10,{ 48, 97}},{ 5,10,{ 48, 99}},{ 5,10,{ 48, 99}},
+  { 5,10,{ 48,101}},{ 5,10,{ 48,101}},{ 5,10,{ 48,105}},{ 5,10,{ 48,105}},{ 5,10,{ 48,111}},
+  { 5,10,{ 48,111}},{ 5,10,{ 48,115}},{ 5,10,{ 48,115}},{ 5,10,{ 48,116}},{ 5,10,{ 48,116}},
+  { 5,11,{ 48, 32}},{ 5,11,{ 48, 37}},{ 5,11,{ 48, 45}},{ 5,11,{ 48, 46}},{ 5,11,{ 48, 47}},
+  { 5,11,{ 48, 51}},{ 5,11,{ 48, 52}},{ 5,11,{ 48, 53}},{ 5,11,{ 48, 54}},{ 5,11,{ 48, 55}},
+  { 5,11,{ 48, 56}},{ 5,11,{ 48, 57}},{ 5,11,{ 48, 61}},{ 5,11,{ 48, 65}},{ 5,11,{ 48, 95}},
+  { 5,11,{ 48, 98}},{ 5,11,{ 48,100}},{ 5,11,{ 48,102}},{ 5,11,{ 48,103}},{ 5,11,{ 48,104}},
+  { 5,11,{ 48,108}},{ 5,11,{ 48,109}},{ 5,11,{ 48,110}},{ 5,11,{ 48,112}},{ 5,11,{ 48,114}},
+  { 5,11,{ 48,117}},{ 5, 5,{ 48,  0}},{ 5, 5,{ 48,  0}},{ 5, 5,{ 48,  0}},{ 5, 5,{ 48,  0}},
+  { 5, 5,{ 48,  0}},{ 5, 5,{ 48,  0}},{ 5, 5,{ 48,  0}},{ 5, 5,{ 48,  0}},{ 5, 5,{ 48,  0}},
+  { 5, 5,{ 48,  0}},{ 5, 5,{ 48,  0}},{ 5, 5,{ 48,  0}},{ 5, 5,{ 48,  0}},{ 5, 5,{ 48,  0}},
+  { 5, 5,{ 48,  0}},{ 5, 5,{ 48,  0}},{ 5, 5,{ 48,  0}},{ 5, 5,{ 48,  0}},{ 5,10,{ 49, 48}},
+  { 5,10,{ 49, 48}},{ 5,10,{ 49, 49}},{ 5,10,{ 49, 49}},{ 5,10,{ 49, 50}},{ 5,10,{ 49, 50}},
+  { 5,10,{ 49, 97}},{ 5,10,{ 49, 97}},{ 5,10,{ 49, 99}},{ 5,10,{ 49, 99}},{ 5,10,{ 49,101}},
+  { 5,10,{ 49,101}},{ 5,10,{ 49,105}},{ 5,10,{ 49,105}},{ 5,10,{ 49,111}},{ 5,10,{ 49,111}},
+  { 5,10,{ 49,115}},{ 5,10,{ 49,115}},{ 5,10,{ 49,116}},{ 5,10,{ 49,116}},{ 5,11,{ 49, 32}},
+  { 5,11,{ 49, 37}},{ 5,11,{ 49, 45}},{ 5,11,{ 49, 46}},{ 5,11,{ 49, 47}},{ 5,11,{ 49, 51}},
+  { 5,11,{ 49, 52}},{ 5,11,{ 49, 53}},{ 5,11,{ 49, 54}},{ 5,11,{ 49, 55}},{ 5,11,{ 49, 56}},
+  { 5,11,{ 49, 57}},{ 5,11,{ 49, 61}},{ 5,11,{ 49, 65}},{ 5,11,{ 49, 95}},{ 5,11,{ 49, 98}},
+  { 5,11,{ 49,100}},{ 5,11,{ 49,102}},{ 5,11,{ 49,103}},{ 5,11,{ 49,104}},{ 5,11,{ 49,108}},
+  { 5,11,{ 49,109}},{ 5,11,{ 49,110}},{ 5,11,{ 49,112}},{ 5,11,{ 49,114}},{ 5,11,{ 49,117}},
+  { 5, 5,{ 49,  0}},{ 5, 5,{ 49,  0}},{ 5, 5,{ 49,  0}},{ 5, 5,{ 49,  0}},{ 5, 5,{ 49,  0}},
+  { 5, 5,{ 49,  0}},{ 5, 5,{ 49,  0}},{ 5, 5,{ 49,  0}},{ 5, 5,{ 49,  0}},{ 5, 5,{ 49,  0}},
+  { 5, 5,{ 49,  0}},{ 5, 5,{ 49,  0}},{ 5, 5,{ 49,  0}},{ 5, 5,{ 49,  0}},{ 5, 5,{ 49,  0}},
+  { 5, 5,{ 49,  0}},{ 5, 5,{ 49,  0}},{ 5, 5,{ 49,  0}},{ 5,10,{ 50, 48}},{ 5,10,{ 50, 48}},
+  { 5,10,{ 50, 49}},{ 5,10,{ 50, 49}},{ 5,10,{ 50, 50}},{ 5,10,{ 50, 50}},{ 5,10,{ 50, 97}},
+  { 5,10,{ 50, 97}},{ 5,10,{ 50, 99}},{ 5,10,{ 50, 99}},{ 5,10,{ 50,101}},{ 5,10,{ 50,101}},
+  { 5,10,{ 50,105}},{ 5,10,{ 50,105}},{ 5,10,{ 50,111}},{ 5,10,{ 50,111}},{ 5,10,{ 50,115}},
+  { 5,10,{ 50,115}},{ 5,10,{ 50,116}},{ 5,10,{ 50,116}},{ 5,11,{ 50, 32}},{ 5,11,{ 50, 37}},
+  { 5,11,{ 50, 45}},{ 5,11,{ 50, 46}},{ 5,11,{ 50, 47}},{ 5,11,{ 50, 51}},{ 5,11,{ 50, 52}},
+  { 5,11,{ 50, 53}},{ 5,11,{ 50, 54}},{ 5,11,{ 50, 55}},{ 5,11,{ 50, 56}},{ 5,11,{ 50, 57}},
+  { 5,11,{ 50, 61}},{ 5,11,{ 50, 65}},{ 5,11,{ 50, 95}},{ 5,11,{ 50, 98}},{ 5,11,{ 50,100}},
+  { 5,11,{ 50,102}},{ 5,11,{ 50,103}},{ 5,11,{ 50,104}},{ 5,11,{ 50,108}},{ 5,11,{ 50,109}},
+  { 5,11,{ 50,110}},{ 5,11,{ 50,112}},{ 5,11,{ 50,114}},{ 5,11,{ 50,117}},{ 5, 5,{ 50,  0}},
+  { 5, 5,{ 50,  0}},{ 5, 5,{ 50,  0}},{ 5, 5,{ 50,  0}},{ 5, 5,{ 50,  0}},{ 5, 5,{ 50,  0}},
+  { 5, 5,{ 50,  0}},{ 5, 5,{ 50,  0}},{ 5, 5,{ 50,  0}},{ 5, 5,{ 50,  0}},{ 5, 5,{ 50,  0}},
+  { 5, 5,{ 50,  0}},{ 5, 5,{ 50,  0}},{ 5, 5,{ 50,  0}},{ 5, 5,{ 50,  0}},{ 5, 5,{ 50,  0}},
+  { 5, 5,{ 50,  0}},{ 5, 5,{ 50,  0}},{ 5,10,{ 97, 48}},{ 5,10,{ 97, 48}},{ 5,10,{ 97, 49}},
+  { 5,10,{ 97, 49}},{ 5,10,{ 97, 50}},{ 5,10,{ 97, 50}},{ 5,10,{ 97, 97}},{ 5,10,{ 97, 97}},
+  { 5,10,{ 97, 99}},{ 5,10,{ 97, 99}},{ 5,10,{ 97,101}},{ 5,10,{ 97,101}},{ 5,10,{ 97,105}},
+  { 5,10,{ 97,105}},{ 5,10,{ 97,111}},{ 5,10,{ 97,111}},{ 5,10,{ 97,115}},{ 5,10,{ 97,115}},
+  { 5,10,{ 97,116}},{ 5,10,{ 97,116}},{ 5,11,{ 97, 32}},{ 5,11,{ 97, 37}},{ 5,11,{ 97, 45}},
+  { 5,11,{ 97, 46}},{ 5,11,{ 97, 47}},{ 5,11,{ 97, 51}},{ 5,11,{ 97, 52}},{ 5,11,{ 97, 53}},
+  { 5,11,{ 97, 54}},{ 5,11,{ 97, 55}},{ 5,11,{ 97, 56}},{ 5,11,{ 97, 57}},{ 5,11,{ 97, 61}},
+  { 5,11,{ 97, 65}},{ 5,11,{ 97, 95}},{ 5,11,{ 97, 98}},{ 5,11,{ 97,100}},{ 5,11,{ 97,102}},
+  { 5,11,{ 97,103}},{ 5,11,{ 97,104}},{ 5,11,{ 97,108}},{ 5,11,{ 97,109}},{ 5,11,{ 97,110}},
+  { 5,11,{ 97,112}},{ 5,11,{ 97,114}},{ 5,11,{ 97,117}},{ 5, 5,{ 97,  0}},{ 5, 5,{ 97,  0}},
+  { 5, 5,{ 97,  0}},{ 5, 5,{ 97,  0}},{ 5, 5,{ 97,  0}},{ 5, 5,{ 97,  0}},{ 5, 5,{ 97,  0}},
+  { 5, 5,{ 97,  0}},{ 5, 5,{ 97,  0}},{ 5, 5,{ 97,  0}},{ 5, 5,{ 97,  0}},{ 5, 5,{ 97,  0}},
+  { 5, 5,{ 97,  0}},{ 5, 5,{ 97,  0}},{ 5, 5,{ 97,  0}},{ 5, 5,{ 97,  0}},{ 5, 5,{ 97,  0}},
+  { 5, 5,{ 97,  0}},{ 5,10,{ 99, 48}},{ 5,10,{ 99, 48}},{ 5,10,{ 99, 49}},{ 5,10,{ 99, 49}},
+  { 5,10,{ 99, 50}},{ 5,10,{ 99, 50}},{ 5,10,{ 99, 97}},{ 5,10,{ 99, 97}},{ 5,10,{ 99, 99}},
+  { 5,10,{ 99, 99}},{ 5,10,{ 99,101}},{ 5,10,{ 99,101}},{ 5,10,{ 99,105}},{ 5,10,{ 99,105}},
+  { 5,10,{ 99,111}},{ 5,10,{ 99,111}},{ 5,10,{ 99,115}},{ 5,10,{ 99,115}},{ 5,10,{ 99,116}},
+  { 5,10,{ 99,116}},{ 5,11,{ 99, 32}},{ 5,11,{ 99, 37}},{ 5,11,{ 99, 45}},{ 5,11,{ 99, 46}},
+  { 5,11,{ 99, 47}},{ 5,11,{ 99, 51}},{ 5,11,{ 99, 52}},{ 5,11,{ 99, 53}},{ 5,11,{ 99, 54}},
+  { 5,11,{ 99, 55}},{ 5,11,{ 99, 56}},{ 5,11,{ 99, 57}},{ 5,11,{ 99, 61}},{ 5,11,{ 99, 65}},
+  { 5,11,{ 99, 95}},{ 5,11,{ 99, 98}},{ 5,11,{ 99,100}},{ 5,11,{ 99,102}},{ 5,11,{ 99,103}},
+  { 5,11,{ 99,104}},{ 5,11,{ 99,108}},{ 5,11,{ 99,109}},{ 5,11,{ 99,110}},{ 5,11,{ 99,112}},
+  { 5,11,{ 99,114}},{ 5,11,{ 99,117}},{ 5, 5,{ 99,  0}},{ 5, 5,{ 99,  0}},{ 5, 5,{ 99,  0}},
+  { 5, 5,{ 99,  0}},{ 5, 5,{ 99,  0}},{ 5, 5,{ 99,  0}},{ 5, 5,{ 99,  0}},{ 5, 5,{ 99,  0}},
+  { 5, 5,{ 99,  0}},{ 5, 5,{ 99,  0}},{ 5, 5,{ 99,  0}},{ 5, 5,{ 99,  0}},{ 5, 5,{ 99,  0}},
+  { 5, 5,{ 99,  0}},{ 5, 5,{ 99,  0}},{ 5, 5,{ 99,  0}},{ 5, 5,{ 99,  0}},{ 5, 5,{ 99,  0}},
+  { 5,10,{101, 48}},{ 5,10,{101, 48}},{ 5,10,{101, 49}},{ 5,10,{101, 49}},{ 5,10,{101, 50}},
+  { 5,10,{101, 50}},{ 5,10,{101, 97}},{ 5,10,{101, 97}},{ 5,10,{101, 99}},{ 5,10,{101, 99}},
+  { 5,10,{101,101}},{ 5,10,{101,101}},{ 5,10,{101,105}},{ 5,10,{101,105}},{ 5,10,{101,111}},
+  { 5,10,{101,111}},{ 5,10,{101,115}},{ 5,10,{101,115}},{ 5,10,{101,116}},{ 5,10,{101,116}},
+  { 5,11,{101, 32}},{ 5,11,{101, 37}},{ 5,11,{101, 45}},{ 5,11,{101, 46}},{ 5,11,{101, 47}},
+  { 5,11,{101, 51}},{ 5,11,{101, 52}},{ 5,11,{101, 53}},{ 5,11,{101, 54}},{ 5,11,{101, 55}},
+  { 5,11,{101, 56}},{ 5,11,{101, 57}},{ 5,11,{101, 61}},{ 5,11,{101, 65}},{ 5,11,{101, 95}},
+  { 5,11,{101, 98}},{ 5,11,{101,100}},{ 5,11,{101,102}},{ 5,11,{101,103}},{ 5,11,{101,104}},
+  { 5,11,{101,108}},{ 5,11,{101,109}},{ 5,11,{101,110}},{ 5,11,{101,112}},{ 5,11,{101,114}},
+  { 5,11,{101,117}},{ 5, 5,{101,  0}},{ 5, 5,{101,  0}},{ 5, 5,{101,  0}},{ 5, 5,{101,  0}},
+  { 5, 5,{101,  0}},{ 5, 5,{101,  0}},{ 5, 5,{101,  0}},{ 5, 5,{101,  0}},{ 5, 5,{101,  0}},
+  { 5, 5,{101,  0}},{ 5, 5,{101,  0}},{ 5, 5,{101,  0}},{ 5, 5,{101,  0}},{ 5, 5,{101,  0}},
+  { 5, 5,{101,  0}},{ 5, 5,{101,  0}},{ 5, 5,{101,  0}},{ 5, 5,{101,  0}},{ 5,10,{105, 48}},
+  { 5,10,{105, 48}},{ 5,10,{105, 49}},{ 5,10,{105, 49}},{ 5,10,{105, 50}},{ 5,10,{105, 50}},
+  { 5,10,{105, 97}},{ 5,10,{105, 97}},{ 5,10,{105, 99}},{ 5,10,{105, 99}},{ 5,10,{105,101}},
+  { 5,10,{105,101}},{ 5,10,{105,105}},{ 5,10,{105,105}},{ 5,10,{105,111}},{ 5,10,{105,111}},
+  { 5,10,{105,115}},{ 5,10,{105,115}},{ 5,10,{105,116}},{ 5,10,{105,116}},{ 5,11,{105, 32}},
+  { 5,11,{105, 37}},{ 5,11,{105, 45}},{ 5,11,{105, 46}},{ 5,11,{105, 47}},{ 5,11,{105, 51}},
+  { 5,11,{105, 52}},{ 5,11,{105, 53}},{ 5,11,{105, 54}},{ 5,11,{105, 55}},{ 5,11,{105, 56}},
+  { 5,11,{105, 57}},{ 5,11,{105, 61}},{ 5,11,{105, 65}},{ 5,11,{105, 95}},{ 5,11,{105, 98}},
+  { 5,11,{105,100}},{ 5,11,{105,102}},{ 5,11,{105,103}},{ 5,11,{105,104}},{ 5,11,{105,108}},
+  { 5,11,{105,109}},{ 5,11,{105,110}},{ 5,11,{105,112}},{ 5,11,{105,114}},{ 5,11,{105,117}},
+  { 5, 5,{105,  0}},{ 5, 5,{105,  0}},{ 5, 5,{105,  0}},{ 5, 5,{105,  0}},{ 5, 5,{105,  0}},
+  { 5, 5,{105,  0}},{ 5, 5,{105,  0}},{ 5, 5,{105,  0}},{ 5, 5,{105,  0}},{ 5, 5,{105,  0}},
+  { 5, 5,{105,  0}},{ 5, 5,{105,  0}},{ 5, 5,{105,  0}},{ 5, 5,{105,  0}},{ 5, 5,{105,  0}},
+  { 5, 5,{105,  0}},{ 5, 5,{105,  0}},{ 5, 5,{105,  0}},{ 5,10,{111, 48}},{ 5,10,{111, 48}},
+  { 5,10,{111, 49}},{ 5,10,{111, 49}},{ 5,10,{111, 50}},{ 5,10,{111, 50}},{ 5,10,{111, 97}},
+  { 5,10,{111, 97}},{ 5,10,{111, 99}},{ 5,10,{111, 99}},{ 5,10,{111,101}},{ 5,10,{111,101}},
+  { 5,10,{111,105}},{ 5,10,{111,105}},{ 5,10,{111,111}},{ 5,10,{111,111}},{ 5,10,{111,115}},
+  { 5,10,{111,115}},{ 5,10,{111,116}},{ 5,10,{111,116}},{ 5,11,{111, 32}},{ 5,11,{111, 37}},
+  { 5,11,{111, 45}},{ 5,11,{111, 46}},{ 5,11,{111, 47}},{ 5,11,{111, 51}},{ 5,11,{111, 52}},
+  { 5,11,{111, 53}},{ 5,11,{111, 54}},{ 5,11,{111, 55}},{ 5,11,{111, 56}},{ 5,11,{111, 57}},
+  { 5,11,{111, 61}},{ 5,11,{111, 65}},{ 5,11,{111, 95}},{ 5,11,{111, 98}},{ 5,11,{111,100}},
+  { 5,11,{111,102}},{ 5,11,{111,103}},{ 5,11,{111,104}},{ 5,11,{111,108}},{ 5,11,{111,109}},
+  { 5,11,{111,110}},{ 5,11,{111,112}},{ 5,11,{111,114}},{ 5,11,{111,117}},{ 5, 5,{111,  0}},
+  { 5, 5,{111,  0}},{ 5, 5,{111,  0}},{ 5, 5,{111,  0}},{ 5, 5,{111,  0}},{ 5, 5,{111,  0}},
+  { 5, 5,{111,  0}},{ 5, 5,{111,  0}},{ 5, 5,{111,  0}},{ 5, 5,{111,  0}},{ 5, 5,{111,  0}},
+  { 5, 5,{111,  0}},{ 5, 5,{111,  0}},{ 5, 5,{111,  0}},{ 5, 5,{111,  0}},{ 5, 5,{111,  0}},
+  { 5, 5,{111,  0}},{ 5, 5,{111,  0}},{ 5,10,{115, 48}},{ 5,10,{115, 48}},{ 5,10,{115, 49}},
+  { 5,10,{115, 49}},{ 5,10,{115, 50}},{ 5,10,{115, 50}},{ 5,10,{115, 97}},{ 5,10,{115, 97}},
+  { 5,10,{115, 99}},{ 5,10,{115, 99}},{ 5,10,{115,101}},{ 5,10,{115,101}},{ 5,10,{115,105}},
+  { 5,10,{115,105}},{ 5,10,{115,111}},{ 5,10,{115,111}},{ 5,10,{115,115}},{ 5,10,{115,115}},
+  { 5,10,{115,116}},{ 5,10,{115,116}},{ 5,11,{115, 32}},{ 5,11,{115, 37}},{ 5,11,{115, 45}},
+  { 5,11,{115, 46}},{ 5,11,{115, 47}},{ 5,11,{115, 51}},{ 5,11,{115, 52}},{ 5,11,{115, 53}},
+  { 5,11,{115, 54}},{ 5,11,{115, 55}},{ 5,11,{115, 56}},{ 5,11,{115, 57}},{ 5,11,{115, 61}},
+  { 5,11,{115, 65}},{ 5,11,{115, 95}},{ 5,11,{115, 98}},{ 5,11,{115,100}},{ 5,11,{115,102}},
+  { 5,11,{115,103}},{ 5,11,{115,104}},{ 5,11,{115,108}},{ 5,11,{115,109}},{ 5,11,{115,110}},
+  { 5,11,{115,112}},{ 5,11,{115,114}},{ 5,11,{115,117}},{ 5, 5,{115,  0}},{ 5, 5,{115,  0}},
+  { 5, 5,{115,  0}},{ 5, 5,{115,  0}},{ 5, 5,{115,  0}},{ 5, 5,{115,  0}},{ 5, 5,{115,  0}},
+  { 5, 5,{115,  0}},{ 5, 5,{115,  0}},{ 5, 5,{115,  0}},{ 5, 5,{115,  0}},{ 5, 5,{115,  0}},
+  { 5, 5,{115,  0}},{ 5, 5,{115,  0}},{ 5, 5,{115,  0}},{ 5, 5,{115,  0}},{ 5, 5,{115,  0}},
+  { 5, 5,{115,  0}},{ 5,10,{116, 48}},{ 5,10,{116, 48}},{ 5,10,{116, 49}},{ 5,10,{116, 49}},
+  { 5,10,{116, 50}},{ 5,10,{116, 50}},{ 5,10,{116, 97}},{ 5,10,{116, 97}},{ 5,10,{116, 99}},
+  { 5,10,{116, 99}},{ 5,10,{116,101}},{ 5,10,{116,101}},{ 5,10,{116,105}},{ 5,10,{116,105}},
+  { 5,10,{116,111}},{ 5,10,{116,111}},{ 5,10,{116,115}},{ 5,10,{116,115}},{ 5,10,{116,116}},
+  { 5,10,{116,116}},{ 5,11,{116, 32}},{ 5,11,{116, 37}},{ 5,11,{116, 45}},{ 5,11,{116, 46}},
+  { 5,11,{116, 47}},{ 5,11,{116, 51}},{ 5,11,{116, 52}},{ 5,11,{116, 53}},{ 5,11,{116, 54}},
+  { 5,11,{116, 55}},{ 5,11,{116, 56}},{ 5,11,{116, 57}},{ 5,11,{116, 61}},{ 5,11,{116, 65}},
+  { 5,11,{116, 95}},{ 5,11,{116, 98}},{ 5,11,{116,100}},{ 5,11,{116,102}},{ 5,11,{116,103}},
+  { 5,11,{116,104}},{ 5,11,{116,108}},{ 5,11,{116,109}},{ 5,11,{116,110}},{ 5,11,{116,112}},
+  { 5,11,{116,114}},{ 5,11,{116,117}},{ 5, 5,{116,  0}},{ 5, 5,{116,  0}},{ 5, 5,{116,  0}},
+  { 5, 5,{116,  0}},{ 5, 5,{116,  0}},{ 5, 5,{116,  0}},{ 5, 5,{116,  0}},{ 5, 5,{116,  0}},
+  { 5, 5,{116,  0}},{ 5, 5,{116,  0}},{ 5, 5,{116,  0}},{ 5, 5,{116,  0}},{ 5, 5,{116,  0}},
+  { 5, 5,{116,  0}},{ 5, 5,{116,  0}},{ 5, 5,{116,  0}},{ 5, 5,{116,  0}},{ 5, 5,{116,  0}},
+  { 6,11,{ 32, 48}},{ 6,11,{ 32, 49}},{ 6,11,{ 32, 50}},{ 6,11,{ 32, 97}},{ 6,11,{ 32, 99}},
+  { 6,11,{ 32,101}},{ 6,11,{ 32,105}},{ 6,11,{ 32,111}},{ 6,11,{ 32,115}},{ 6,11,{ 32,116}},
+  { 6, 6,{ 32,  0}},{ 6, 6,{ 32,  0}},{ 6, 6,{ 32,  0}},{ 6, 6,{ 32,  0}},{ 6, 6,{ 32,  0}},
+  { 6, 6,{ 32,  0}},{ 6, 6,{ 32,  0}},{ 6, 6,{ 32,  0}},{ 6, 6,{ 32,  0}},{ 6, 6,{ 32,  0}},
+  { 6, 6,{ 32,  0}},{ 6, 6,{ 32,  0}},{ 6, 6,{ 32,  0}},{ 6, 6,{ 32,  0}},{ 6, 6,{ 32,  0}},
+  { 6, 6,{ 32,  0}},{ 6, 6,{ 32,  0}},{ 6, 6,{ 32,  0}},{ 6, 6,{ 32,  0}},{ 6, 6,{ 32,  0}},
+  { 6, 6,{ 32,  0}},{ 6, 6,{ 32,  0}},{ 6,11,{ 37, 48}},{ 6,11,{ 37, 49}},{ 6,11,{ 37, 50}},
+  { 6,11,{ 37, 97}},{ 6,11,{ 37, 99}},{ 6,11,{ 37,101}},{ 6,11,{ 37,105}},{ 6,11,{ 37,111}},
+  { 6,11,{ 37,115}},{ 6,11,{ 37,116}},{ 6, 6,{ 37,  0}},{ 6, 6,{ 37,  0}},{ 6, 6,{ 37,  0}},
+  { 6, 6,{ 37,  0}},{ 6, 6,{ 37,  0}},{ 6, 6,{ 37,  0}},{ 6, 6,{ 37,  0}},{ 6, 6,{ 37,  0}},
+  { 6, 6,{ 37,  0}},{ 6, 6,{ 37,  0}},{ 6, 6,{ 37,  0}},{ 6, 6,{ 37,  0}},{ 6, 6,{ 37,  0}},
+  { 6, 6,{ 37,  0}},{ 6, 6,{ 37,  0}},{ 6, 6,{ 37,  0}},{ 6, 6,{ 37,  0}},{ 6, 6,{ 37,  0}},
+  { 6, 6,{ 37,  0}},{ 6, 6,{ 37,  0}},{ 6, 6,{ 37,  0}},{ 6, 6,{ 37,  0}},{ 6,11,{ 45, 48}},
+  { 6,11,{ 45, 49}},{ 6,11,{ 45, 50}},{ 6,11,{ 45, 97}},{ 6,11,{ 45, 99}},{ 6,11,{ 45,101}},
+  { 6,11,{ 45,105}},{ 6,11,{ 45,111}},{ 6,11,{ 45,115}},{ 6,11,{ 45,116}},{ 6, 6,{ 45,  0}},
+  { 6, 6,{ 45,  0}},{ 6, 6,{ 45,  0}},{ 6, 6,{ 45,  0}},{ 6, 6,{ 45,  0}},{ 6, 6,{ 45,  0}},
+  { 6, 6,{ 45,  0}},{ 6, 6,{ 45,  0}},{ 6, 6,{ 45,  0}},{ 6, 6,{ 45,  0}},{ 6, 6,{ 45,  0}},
+  { 6, 6,{ 45,  0}},{ 6, 6,{ 45,  0}},{ 6, 6,{ 45,  0}},{ 6, 6,{ 45,  0}},{ 6, 6,{ 45,  0}},
+  { 6, 6,{ 45,  0}},{ 6, 6,{ 45,  0}},{ 6, 6,{ 45,  0}},{ 6, 6,{ 45,  0}},{ 6, 6,{ 45,  0}},
+  { 6, 6,{ 45,  0}},{ 6,11,{ 46, 48}},{ 6,11,{ 46, 49}},{ 6,11,{ 46, 50}},{ 6,11,{ 46, 97}},
+  { 6,11,{ 46, 99}},{ 6,11,{ 46,101}},{ 6,11,{ 46,105}},{ 6,11,{ 46,111}},{ 6,11,{ 46,115}},
+  { 6,11,{ 46,116}},{ 6, 6,{ 46,  0}},{ 6, 6,{ 46,  0}},{ 6, 6,{ 46,  0}},{ 6, 6,{ 46,  0}},
+  { 6, 6,{ 46,  0}},{ 6, 6,{ 46,  0}},{ 6, 6,{ 46,  0}},{ 6, 6,{ 46,  0}},{ 6, 6,{ 46,  0}},
+  { 6, 6,{ 46,  0}},{ 6, 6,{ 46,  0}},{ 6, 6,{ 46,  0}},{ 6, 6,{ 46,  0}},{ 6, 6,{ 46,  0}},
+  { 6, 6,{ 46,  0}},{ 6, 6,{ 46,  0}},{ 6, 6,{ 46,  0}},{ 6, 6,{ 46,  0}},{ 6, 6,{ 46,  0}},
+  { 6, 6,{ 46,  0}},{ 6, 6,{ 46,  0}},{ 6, 6,{ 46,  0}},{ 6,11,{ 47, 48}},{ 6,11,{ 47, 49}},
+  { 6,11,{ 47, 50}},{ 6,11,{ 47, 97}},{ 6,11,{ 47, 99}},{ 6,11,{ 47,101}},{ 6,11,{ 47,105}},
+  { 6,11,{ 47,111}},{ 6,11,{ 47,115}},{ 6,11,{ 47,116}},{ 6, 6,{ 47,  0}},{ 6, 6,{ 47,  0}},
+  { 6, 6,{ 47,  0}},{ 6, 6,{ 47,  0}},{ 6, 6,{ 47,  0}},{ 6, 6,{ 47,  0}},{ 6, 6,{ 47,  0}},
+  { 6, 6,{ 47,  0}},{ 6, 6,{ 47,  0}},{ 6, 6,{ 47,  0}},{ 6, 6,{ 47,  0}},{ 6, 6,{ 47,  0}},
+  { 6, 6,{ 47,  0}},{ 6, 6,{ 47,  0}},{ 6, 6,{ 47,  0}},{ 6, 6,{ 47,  0}},{ 6, 6,{ 47,  0}},
+  { 6, 6,{ 47,  0}},{ 6, 6,{ 47,  0}},{ 6, 6,{ 47,  0}},{ 6, 6,{ 47,  0}},{ 6, 6,{ 47,  0}},
+  { 6,11,{ 51, 48}},{ 6,11,{ 51, 49}},{ 6,11,{ 51, 50}},{ 6,11,{ 51, 97}},{ 6,11,{ 51, 99}},
+  { 6,11,{ 51,101}},{ 6,11,{ 51,105}},{ 6,11,{ 51,111}},{ 6,11,{ 51,115}},{ 6,11,{ 51,116}},
+  { 6, 6,{ 51,  0}},{ 6, 6,{ 51,  0}},{ 6, 6,{ 51,  0}},{ 6, 6,{ 51,  0}},{ 6, 6,{ 51,  0}},
+  { 6, 6,{ 51,  0}},{ 6, 6,{ 51,  0}},{ 6, 6,{ 51,  0}},{ 6, 6,{ 51,  0}},{ 6, 6,{ 51,  0}},
+  { 6, 6,{ 51,  0}},{ 6, 6,{ 51,  0}},{ 6, 6,{ 51,  0}},{ 6, 6,{ 51,  0}},{ 6, 6,{ 51,  0}},
+  { 6, 6,{ 51,  0}},{ 6, 6,{ 51,  0}},{ 6, 6,{ 51,  0}},{ 6, 6,{ 51,  0}},{ 6, 6,{ 51,  0}},
+  { 6, 6,{ 51,  0}},{ 6, 6,{ 51,  0}},{ 6,11,{ 52, 48}},{ 6,11,{ 52, 49}},{ 6,11,{ 52, 50}},
+  { 6,11,{ 52, 97}},{ 6,11,{ 52, 99}},{ 6,11,{ 52,101}},{ 6,11,{ 52,105}},{ 6,11,{ 52,111}},
+  { 6,11,{ 52,115}},{ 6,11,{ 52,116}},{ 6, 6,{ 52,  0}},{ 6, 6,{ 52,  0}},{ 6, 6,{ 52,  0}},
+  { 6, 6,{ 52,  0}},{ 6, 6,{ 52,  0}},{ 6, 6,{ 52,  0}},{ 6, 6,{ 52,  0}},{ 6, 6,{ 52,  0}},
+  { 6, 6,{ 52,  0}},{ 6, 6,{ 52,  0}},{ 6, 6,{ 52,  0}},{ 6, 6,{ 52,  0}},{ 6, 6,{ 52,  0}},
+  { 6, 6,{ 52,  0}},{ 6, 6,{ 52,  0}},{ 6, 6,{ 52,  0}},{ 6, 6,{ 52,  0}},{ 6, 6,{ 52,  0}},
+  { 6, 6,{ 52,  0}},{ 6, 6,{ 52,  0}},{ 6, 6,{ 52,  0}},{ 6, 6,{ 52,  0}},{ 6,11,{ 53, 48}},
+  { 6,11,{ 53, 49}},{ 6,11,{ 53, 50}},{ 6,11,{ 53, 97}},{ 6,11,{ 53, 99}},{ 6,11,{ 53,101}},
+  { 6,11,{ 53,105}},{ 6,11,{ 53,111}},{ 6,11,{ 53,115}},{ 6,11,{ 53,116}},{ 6, 6,{ 53,  0}},
+  { 6, 6,{ 53,  0}},{ 6, 6,{ 53,  0}},{ 6, 6,{ 53,  0}},{ 6, 6,{ 53,  0}},{ 6, 6,{ 53,  0}},
+  { 6, 6,{ 53,  0}},{ 6, 6,{ 53,  0}},{ 6, 6,{ 53,  0}},{ 6, 6,{ 53,  0}},{ 6, 6,{ 53,  0}},
+  { 6, 6,{ 53,  0}},{ 6, 6,{ 53,  0}},{ 6, 6,{ 53,  0}},{ 6, 6,{ 53,  0}},{ 6, 6,{ 53,  0}},
+  { 6, 6,{ 53,  0}},{ 6, 6,{ 53,  0}},{ 6, 6,{ 53,  0}},{ 6, 6,{ 53,  0}},{ 6, 6,{ 53,  0}},
+  { 6, 6,{ 53,  0}},{ 6,11,{ 54, 48}},{ 6,11,{ 54, 49}},{ 6,11,{ 54, 50}},{ 6,11,{ 54, 97}},
+  { 6,11,{ 54, 99}},{ 6,11,{ 54,101}},{ 6,11,{ 54,105}},{ 6,11,{ 54,111}},{ 6,11,{ 54,115}},
+  { 6,11,{ 54,116}},{ 6, 6,{ 54,  0}},{ 6, 6,{ 54,  0}},{ 6, 6,{ 54,  0}},{ 6, 6,{ 54,  0}},
+  { 6, 6,{ 54,  0}},{ 6, 6,{ 54,  0}},{ 6, 6,{ 54,  0}},{ 6, 6,{ 54,  0}},{ 6, 6,{ 54,  0}},
+  { 6, 6,{ 54,  0}},{ 6, 6,{ 54,  0}},{ 6, 6,{ 54,  0}},{ 6, 6,{ 54,  0}},{ 6, 6,{ 54,  0}},
+  { 6, 6,{ 54,  0}},{ 6, 6,{ 54,  0}},{ 6, 6,{ 54,  0}},{ 6, 6,{ 54,  0}},{ 6, 6,{ 54,  0}},
+  { 6, 6,{ 54,  0}},{ 6, 6,{ 54,  0}},{ 6, 6,{ 54,  0}},{ 6,11,{ 55, 48}},{ 6,11,{ 55, 49}},
+  { 6,11,{ 55, 50}},{ 6,11,{ 55, 97}},{ 6,11,{ 55, 99}},{ 6,11,{ 55,101}},{ 6,11,{ 55,105}},
+  { 6,11,{ 55,111}},{ 6,11,{ 55,115}},{ 6,11,{ 55,116}},{ 6, 6,{ 55,  0}},{ 6, 6,{ 55,  0}},
+  { 6, 6,{ 55,  0}},{ 6, 6,{ 55,  0}},{ 6, 6,{ 55,  0}},{ 6, 6,{ 55,  0}},{ 6, 6,{ 55,  0}},
+  { 6, 6,{ 55,  0}},{ 6, 6,{ 55,  0}},{ 6, 6,{ 55,  0}},{ 6, 6,{ 55,  0}},{ 6, 6,{ 55,  0}},
+  { 6, 6,{ 55,  0}},{ 6, 6,{ 55,  0}},{ 6, 6,{ 55,  0}},{ 6, 6,{ 55,  0}},{ 6, 6,{ 55,  0}},
+  { 6, 6,{ 55,  0}},{ 6, 6,{ 55,  0}},{ 6, 6,{ 55,  0}},{ 6, 6,{ 55,  0}},{ 6, 6,{ 55,  0}},
+  { 6,11,{ 56, 48}},{ 6,11,{ 56, 49}},{ 6,11,{ 56, 50}},{ 6,11,{ 56, 97}},{ 6,11,{ 56, 99}},
+  { 6,11,{ 56,101}},{ 6,11,{ 56,105}},{ 6,11,{ 56,111}},{ 6,11,{ 56,115}},{ 6,11,{ 56,116}},
+  { 6, 6,{ 56,  0}},{ 6, 6,{ 56,  0}},{ 6, 6,{ 56,  0}},{ 6, 6,{ 56,  0}},{ 6, 6,{ 56,  0}},
+  { 6, 6,{ 56,  0}},{ 6, 6,{ 56,  0}},{ 6, 6,{ 56,  0}},{ 6, 6,{ 56,  0}},{ 6, 6,{ 56,  0}},
+  { 6, 6,{ 56,  0}},{ 6, 6,{ 56,  0}},{ 6, 6,{ 56,  0}},{ 6, 6,{ 56,  0}},{ 6, 6,{ 56,  0}},
+  { 6, 6,{ 56,  0}},{ 6, 6,{ 56,  0}},{ 6, 6,{ 56,  0}},{ 6, 6,{ 56,  0}},{ 6, 6,{ 56,  0}},
+  { 6, 6,{ 56,  0}},{ 6, 6,{ 56,  0}},{ 6,11,{ 57, 48}},{ 6,11,{ 57, 49}},{ 6,11,{ 57, 50}},
+  { 6,11,{ 57, 97}},{ 6,11,{ 57, 99}},{ 6,11,{ 57,101}},{ 6,11,{ 57,105}},{ 6,11,{ 57,111}},
+  { 6,11,{ 57,115}},{ 6,11,{ 57,116}},{ 6, 6,{ 57,  0}},{ 6, 6,{ 57,  0}},{ 6, 6,{ 57,  0}},
+  { 6, 6,{ 57,  0}},{ 6, 6,{ 57,  0}},{ 6, 6,{ 57,  0}},{ 6, 6,{ 57,  0}},{ 6, 6,{ 57,  0}},
+  { 6, 6,{ 57,  0}},{ 6, 6,{ 57,  0}},{ 6, 6,{ 57,  0}},{ 6, 6,{ 57,  0}},{ 6, 6,{ 57,  0}},
+  { 6, 6,{ 57,  0}},{ 6, 6,{ 57,  0}},{ 6, 6,{ 57,  0}},{ 6, 6,{ 57,  0}},{ 6, 6,{ 57,  0}},
+  { 6, 6,{ 57,  0}},{ 6, 6,{ 57,  0}},{ 6, 6,{ 57,  0}},{ 6, 6,{ 57,  0}},{ 6,11,{ 61, 48}},
+  { 6,11,{ 61, 49}},{ 6,11,{ 61, 50}},{ 6,11,{ 61, 97}},{ 6,11,{ 61, 99}},{ 6,11,{ 61,101}},
+  { 6,11,{ 61,105}},{ 6,11,{ 61,111}},{ 6,11,{ 61,115}},{ 6,11,{ 61,116}},{ 6, 6,{ 61,  0}},
+  { 6, 6,{ 61,  0}},{ 6, 6,{ 61,  0}},{ 6, 6,{ 61,  0}},{ 6, 6,{ 61,  0}},{ 6, 6,{ 61,  0}},
+  { 6, 6,{ 61,  0}},{ 6, 6,{ 61,  0}},{ 6, 6,{ 61,  0}},{ 6, 6,{ 61,  0}},{ 6, 6,{ 61,  0}},
+  { 6, 6,{ 61,  0}},{ 6, 6,{ 61,  0}},{ 6, 6,{ 61,  0}},{ 6, 6,{ 61,  0}},{ 6, 6,{ 61,  0}},
+  { 6, 6,{ 61,  0}},{ 6, 6,{ 61,  0}},{ 6, 6,{ 61,  0}},{ 6, 6,{ 61,  0}},{ 6, 6,{ 61,  0}},
+  { 6, 6,{ 61,  0}},{ 6,11,{ 65, 48}},{ 6,11,{ 65, 49}},{ 6,11,{ 65, 50}},{ 6,11,{ 65, 97}},
+  { 6,11,{ 65, 99}},{ 6,11,{ 65,101}},{ 6,11,{ 65,105}},{ 6,11,{ 65,111}},{ 6,11,{ 65,115}},
+  { 6,11,{ 65,116}},{ 6, 6,{ 65,  0}},{ 6, 6,{ 65,  0}},{ 6, 6,{ 65,  0}},{ 6, 6,{ 65,  0}},
+  { 6, 6,{ 65,  0}},{ 6, 6,{ 65,  0}},{ 6, 6,{ 65,  0}},{ 6, 6,{ 65,  0}},{ 6, 6,{ 65,  0}},
+  { 6, 6,{ 65,  0}},{ 6, 6,{ 65,  0}},{ 6, 6,{ 65,  0}},{ 6, 6,{ 65,  0}},{ 6, 6,{ 65,  0}},
+  { 6, 6,{ 65,  0}},{ 6, 6,{ 65,  0}},{ 6, 6,{ 65,  0}},{ 6, 6,{ 65,  0}},{ 6, 6,{ 65,  0}},
+  { 6, 6,{ 65,  0}},{ 6, 6,{ 65,  0}},{ 6, 6,{ 65,  0}},{ 6,11,{ 95, 48}},{ 6,11,{ 95, 49}},
+  { 6,11,{ 95, 50}},{ 6,11,{ 95, 97}},{ 6,11,{ 95, 99}},{ 6,11,{ 95,101}},{ 6,11,{ 95,105}},
+  { 6,11,{ 95,111}},{ 6,11,{ 95,115}},{ 6,11,{ 95,116}},{ 6, 6,{ 95,  0}},{ 6, 6,{ 95,  0}},
+  { 6, 6,{ 95,  0}},{ 6, 6,{ 95,  0}},{ 6, 6,{ 95,  0}},{ 6, 6,{ 95,  0}},{ 6, 6,{ 95,  0}},
+  { 6, 6,{ 95,  0}},{ 6, 6,{ 95,  0}},{ 6, 6,{ 95,  0}},{ 6, 6,{ 95,  0}},{ 6, 6,{ 95,  0}},
+  { 6, 6,{ 95,  0}},{ 6, 6,{ 95,  0}},{ 6, 6,{ 95,  0}},{ 6, 6,{ 95,  0}},{ 6, 6,{ 95,  0}},
+  { 6, 6,{ 95,  0}},{ 6, 6,{ 95,  0}},{ 6, 6,{ 95,  0}},{ 6, 6,{ 95,  0}},{ 6, 6,{ 95,  0}},
+  { 6,11,{ 98, 48}},{ 6,11,{ 98, 49}},{ 6,11,{ 98, 50}},{ 6,11,{ 98, 97}},{ 6,11,{ 98, 99}},
+  { 6,11,{ 98,101}},{ 6,11,{ 98,105}},{ 6,11,{ 98,111}},{ 6,11,{ 98,115}},{ 6,11,{ 98,116}},
+  { 6, 6,{ 98,  0}},{ 6, 6,{ 98,  0}},{ 6, 6,{ 98,  0}},{ 6, 6,{ 98,  0}},{ 6, 6,{ 98,  0}},
+  { 6, 6,{ 98,  0}},{ 6, 6,{ 98,  0}},{ 6, 6,{ 98,  0}},{ 6, 6,{ 98,  0}},{ 6, 6,{ 98,  0}},
+  { 6, 6,{ 98,  0}},{ 6, 6,{ 98,  0}},{ 6, 6,{ 98,  0}},{ 6, 6,{ 98,  0}},{ 6, 6,{ 98,  0}},
+  { 6, 6,{ 98,  0}},{ 6, 6,{ 98,  0}},{ 6, 6,{ 98,  0}},{ 6, 6,{ 98,  0}},{ 6, 6,{ 98,  0}},
+  { 6, 6,{ 98,  0}},{ 6, 6,{ 98,  0}},{ 6,11,{100, 48}},{ 6,11,{100, 49}},{ 6,11,{100, 50}},
+  { 6,11,{100, 97}},{ 6,11,{100, 99}},{ 6,11,{100,101}},{ 6,11,{100,105}},{ 6,11,{100,111}},
+  { 6,11,{100,115}},{ 6,11,{100,116}},{ 6, 6,{100,  0}},{ 6, 6,{100,  0}},{ 6, 6,{100,  0}},
+  { 6, 6,{100,  0}},{ 6, 6,{100,  0}},{ 6, 6,{100,  0}},{ 6, 6,{100,  0}},{ 6, 6,{100,  0}},
+  { 6, 6,{100,  0}},{ 6, 6,{100,  0}},{ 6, 6,{100,  0}},{ 6, 6,{100,  0}},{ 6, 6,{100,  0}},
+  { 6, 6,{100,  0}},{ 6, 6,{100,  0}},{ 6, 6,{100,  0}},{ 6, 6,{100,  0}},{ 6, 6,{100,  0}},
+  { 6, 6,{100,  0}},{ 6, 6,{100,  0}},{ 6, 6,{100,  0}},{ 6, 6,{100,  0}},{ 6,11,{102, 48}},
+  { 6,11,{102, 49}},{ 6,11,{102, 50}},{ 6,11,{102, 97}},{ 6,11,{102, 99}},{ 6,11,{102,101}},
+  { 6,11,{102,105}},{ 6,11,{102,111}},{ 6,11,{102,115}},{ 6,11,{102,116}},{ 6, 6,{102,  0}},
+  { 6, 6,{102,  0}},{ 6, 6,{102,  0}},{ 6, 6,{102,  0}},{ 6, 6,{102,  0}},{ 6, 6,{102,  0}},
+  { 6, 6,{102,  0}},{ 6, 6,{102,  0}},{ 6, 6,{102,  0}},{ 6, 6,{102,  0}},{ 6, 6,{102,  0}},
+  { 6, 6,{102,  0}},{ 6, 6,{102,  0}},{ 6, 6,{102,  0}},{ 6, 6,{102,  0}},{ 6, 6,{102,  0}},
+  { 6, 6,{102,  0}},{ 6, 6,{102,  0}},{ 6, 6,{102,  0}},{ 6, 6,{102,  0}},{ 6, 6,{102,  0}},
+  { 6, 6,{102,  0}},{ 6,11,{103, 48}},{ 6,11,{103, 49}},{ 6,11,{103, 50}},{ 6,11,{103, 97}},
+  { 6,11,{103, 99}},{ 6,11,{103,101}},{ 6,11,{103,105}},{ 6,11,{103,111}},{ 6,11,{103,115}},
+  { 6,11,{103,116}},{ 6, 6,{103,  0}},{ 6, 6,{103,  0}},{ 6, 6,{103,  0}},{ 6, 6,{103,  0}},
+  { 6, 6,{103,  0}},{ 6, 6,{103,  0}},{ 6, 6,{103,  0}},{ 6, 6,{103,  0}},{ 6, 6,{103,  0}},
+  { 6, 6,{103,  0}},{ 6, 6,{103,  0}},{ 6, 6,{103,  0}},{ 6, 6,{103,  0}},{ 6, 6,{103,  0}},
+  { 6, 6,{103,  0}},{ 6, 6,{103,  0}},{ 6, 6,{103,  0}},{ 6, 6,{103,  0}},{ 6, 6,{103,  0}},
+  { 6, 6,{103,  0}},{ 6, 6,{103,  0}},{ 6, 6,{103,  0}},{ 6,11,{104, 48}},{ 6,11,{104, 49}},
+  { 6,11,{104, 50}},{ 6,11,{104, 97}},{ 6,11,{104, 99}},{ 6,11,{104,101}},{ 6,11,{104,105}},
+  { 6,11,{104,111}},{ 6,11,{104,115}},{ 6,11,{104,116}},{ 6, 6,{104,  0}},{ 6, 6,{104,  0}},
+  { 6, 6,{104,  0}},{ 6, 6,{104,  0}},{ 6, 6,{104,  0}},{ 6, 6,{104,  0}},{ 6, 6,{104,  0}},
+  { 6, 6,{104,  0}},{ 6, 6,{104,  0}},{ 6, 6,{104,  0}},{ 6, 6,{104,  0}},{ 6, 6,{104,  0}},
+  { 6, 6,{104,  0}},{ 6, 6,{104,  0}},{ 6, 6,{104,  0}},{ 6, 6,{104,  0}},{ 6, 6,{104,  0}},
+  { 6, 6,{104,  0}},{ 6, 6,{104,  0}},{ 6, 6,{104,  0}},{ 6, 6,{104,  0}},{ 6, 6,{104,  0}},
+  { 6,11,{108, 48}},{ 6,11,{108, 49}},{ 6,11,{108, 50}},{ 6,11,{108, 97}},{ 6,11,{108, 99}},
+  { 6,11,{108,101}},{ 6,11,{108,105}},{ 6,11,{108,111}},{ 6,11,{108,115}},{ 6,11,{108,116}},
+  { 6, 6,{108,  0}},{ 6, 6,{108,  0}},{ 6, 6,{108,  0}},{ 6, 6,{108,  0}},{ 6, 6,{108,  0}},
+  { 6, 6,{108,  0}},{ 6, 6,{108,  0}},{ 6, 6,{108,  0}},{ 6, 6,{108,  0}},{ 6, 6,{108,  0}},
+  { 6, 6,{108,  0}},{ 6, 6,{108,  0}},{ 6, 6,{108,  0}},{ 6, 6,{108,  0}},{ 6, 6,{108,  0}},
+  { 6, 6,{108,  0}},{ 6, 6,{108,  0}},{ 6, 6,{108,  0}},{ 6, 6,{108,  0}},{ 6, 6,{108,  0}},
+  { 6, 6,{108,  0}},{ 6, 6,{108,  0}},{ 6,11,{109, 48}},{ 6,11,{109, 49}},{ 6,11,{109, 50}},
+  { 6,11,{109, 97}},{ 6,11,{109, 99}},{ 6,11,{109,101}},{ 6,11,{109,105}},{ 6,11,{109,111}},
+  { 6,11,{109,115}},{ 6,11,{109,116}},{ 6, 6,{109,  0}},{ 6, 6,{109,  0}},{ 6, 6,{109,  0}},
+  { 6, 6,{109,  0}},{ 6, 6,{109,  0}},{ 6, 6,{109,  0}},{ 6, 6,{109,  0}},{ 6, 6,{109,  0}},
+  { 6, 6,{109,  0}},{ 6, 6,{109,  0}},{ 6, 6,{109,  0}},{ 6, 6,{109,  0}},{ 6, 6,{109,  0}},
+  { 6, 6,{109,  0}},{ 6, 6,{109,  0}},{ 6, 6,{109,  0}},{ 6, 6,{109,  0}},{ 6, 6,{109,  0}},
+  { 6, 6,{109,  0}},{ 6, 6,{109,  0}},{ 6, 6,{109,  0}},{ 6, 6,{109,  0}},{ 6,11,{110, 48}},
+  { 6,11,{110, 49}},{ 6,11,{110, 50}},{ 6,11,{110, 97}},{ 6,11,{110, 99}},{ 6,11,{110,101}},
+  { 6,11,{110,105}},{ 6,11,{110,111}},{ 6,11,{110,115}},{ 6,11,{110,116}},{ 6, 6,{110,  0}},
+  { 6, 6,{110,  0}},{ 6, 6,{110,  0}},{ 6, 6,{110,  0}},{ 6, 6,{110,  0}},{ 6, 6,{110,  0}},
+  { 6, 6,{110,  0}},{ 6, 6,{110,  0}},{ 6, 6,{110,  0}},{ 6, 6,{110,  0}},{ 6, 6,{110,  0}},
+  { 6, 6,{110,  0}},{ 6, 6,{110,  0}},{ 6, 6,{110,  0}},{ 6, 6,{110,  0}},{ 6, 6,{110,  0}},
+  { 6, 6,{110,  0}},{ 6, 6,{110,  0}},{ 6, 6,{110,  0}},{ 6, 6,{110,  0}},{ 6, 6,{110,  0}},
+  { 6, 6,{110,  0}},{ 6,11,{112, 48}},{ 6,11,{112, 49}},{ 6,11,{112, 50}},{ 6,11,{112, 97}},
+  { 6,11,{112, 99}},{ 6,11,{112,101}},{ 6,11,{112,105}},{ 6,11,{112,111}},{ 6,11,{112,115}},
+  { 6,11,{112,116}},{ 6, 6,{112,  0}},{ 6, 6,{112,  0}},{ 6, 6,{112,  0}},{ 6, 6,{112,  0}},
+  { 6, 6,{112,  0}},{ 6, 6,{112,  0}},{ 6, 6,{112,  0}},{ 6, 6,{112,  0}},{ 6, 6,{112,  0}},
+  { 6, 6,{112,  0}},{ 6, 6,{112,  0}},{ 6, 6,{112,  0}},{ 6, 6,{112,  0}},{ 6, 6,{112,  0}},
+  { 6, 6,{112,  0}},{ 6, 6,{112,  0}},{ 6, 6,{112,  0}},{ 6, 6,{112,  0}},{ 6, 6,{112,  0}},
+  { 6, 6,{112,  0}},{ 6, 6,{112,  0}},{ 6, 6,{112,  0}},{ 6,11,{114, 48}},{ 6,11,{114, 49}},
+  { 6,11,{114, 50}},{ 6,11,{114, 97}},{ 6,11,{114, 99}},{ 6,11,{114,101}},{ 6,11,{114,105}},
+  { 6,11,{114,111}},{ 6,11,{114,115}},{ 6,11,{114,116}},{ 6, 6,{114,  0}},{ 6, 6,{114,  0}},
+  { 6, 6,{114,  0}},{ 6, 6,{114,  0}},{ 6, 6,{114,  0}},{ 6, 6,{114,  0}},{ 6, 6,{114,  0}},
+  { 6, 6,{114,  0}},{ 6, 6,{114,  0}},{ 6, 6,{114,  0}},{ 6, 6,{114,  0}},{ 6, 6,{114,  0}},
+  { 6, 6,{114,  0}},{ 6, 6,{114,  0}},{ 6, 6,{114,  0}},{ 6, 6,{114,  0}},{ 6, 6,{114,  0}},
+  { 6, 6,{114,  0}},{ 6, 6,{114,  0}},{ 6, 6,{114,  0}},{ 6, 6,{114,  0}},{ 6, 6,{114,  0}},
+  { 6,11,{117, 48}},{ 6,11,{117, 49}},{ 6,11,{117, 50}},{ 6,11,{117, 97}},{ 6,11,{117, 99}},
+  { 6,11,{117,101}},{ 6,11,{117,105}},{ 6,11,{117,111}},{ 6,11,{117,115}},{ 6,11,{117,116}},
+  { 6, 6,{117,  0}},{ 6, 6,{117,  0}},{ 6, 6,{117,  0}},{ 6, 6,{117,  0}},{ 6, 6,{117,  0}},
+  { 6, 6,{117,  0}},{ 6, 6,{117,  0}},{ 6, 6,{117,  0}},{ 6, 6,{117,  0}},{ 6, 6,{117,  0}},
+  { 6, 6,{117,  0}},{ 6, 6,{117,  0}},{ 6, 6,{117,  0}},{ 6, 6,{117,  0}},{ 6, 6,{117,  0}},
+  { 6, 6,{117,  0}},{ 6, 6,{117,  0}},{ 6, 6,{117,  0}},{ 6, 6,{117,  0}},{ 6, 6,{117,  0}},
+  { 6, 6,{117,  0}},{ 6, 6,{117,  0}},{ 7, 7,{ 58,  0}},{ 7, 7,{ 58,  0}},{ 7, 7,{ 58,  0}},
+  { 7, 7,{ 58,  0}},{ 7, 7,{ 58,  0}},{ 7, 7,{ 58,  0}},{ 7, 7,{ 58,  0}},{ 7, 7,{ 58,  0}},
+  { 7, 7,{ 58,  0}},{ 7, 7,{ 58,  0}},{ 7, 7,{ 58,  0}},{ 7, 7,{ 58,  0}},{ 7, 7,{ 58,  0}},
+  { 7, 7,{ 58,  0}},{ 7, 7,{ 58,  0}},{ 7, 7,{ 58,  0}},{ 7, 7,{ 66,  0}},{ 7, 7,{ 66,  0}},
+  { 7, 7,{ 66,  0}},{ 7, 7,{ 66,  0}},{ 7, 7,{ 66,  0}},{ 7, 7,{ 66,  0}},{ 7, 7,{ 66,  0}},
+  { 7, 7,{ 66,  0}},{ 7, 7,{ 66,  0}},{ 7, 7,{ 66,  0}},{ 7, 7,{ 66,  0}},{ 7, 7,{ 66,  0}},
+  { 7, 7,{ 66,  0}},{ 7, 7,{ 66,  0}},{ 7, 7,{ 66,  0}},{ 7, 7,{ 66,  0}},{ 7, 7,{ 67,  0}},
+  { 7, 7,{ 67,  0}},{ 7, 7,{ 67,  0}},{ 7, 7,{ 67,  0}},{ 7, 7,{ 67,  0}},{ 7, 7,{ 67,  0}},
+  { 7, 7,{ 67,  0}},{ 7, 7,{ 67,  0}},{ 7, 7,{ 67,  0}},{ 7, 7,{ 67,  0}},{ 7, 7,{ 67,  0}},
+  { 7, 7,{ 67,  0}},{ 7, 7,{ 67,  0}},{ 7, 7,{ 67,  0}},{ 7, 7,{ 67,  0}},{ 7, 7,{ 67,  0}},
+  { 7, 7,{ 68,  0}},{ 7, 7,{ 68,  0}},{ 7, 7,{ 68,  0}},{ 7, 7,{ 68,  0}},{ 7, 7,{ 68,  0}},
+  { 7, 7,{ 68,  0}},{ 7, 7,{ 68,  0}},{ 7, 7,{ 68,  0}},{ 7, 7,{ 68,  0}},{ 7, 7,{ 68,  0}},
+  { 7, 7,{ 68,  0}},{ 7, 7,{ 68,  0}},{ 7, 7,{ 68,  0}},{ 7, 7,{ 68,  0}},{ 7, 7,{ 68,  0}},
+  { 7, 7,{ 68,  0}},{ 7, 7,{ 69,  0}},{ 7, 7,{ 69,  0}},{ 7, 7,{ 69,  0}},{ 7, 7,{ 69,  0}},
+  { 7, 7,{ 69,  0}},{ 7, 7,{ 69,  0}},{ 7, 7,{ 69,  0}},{ 7, 7,{ 69,  0}},{ 7, 7,{ 69,  0}},
+  { 7, 7,{ 69,  0}},{ 7, 7,{ 69,  0}},{ 7, 7,{ 69,  0}},{ 7, 7,{ 69,  0}},{ 7, 7,{ 69,  0}},
+  { 7, 7,{ 69,  0}},{ 7, 7,{ 69,  0}},{ 7, 7,{ 70,  0}},{ 7, 7,{ 70,  0}},{ 7, 7,{ 70,  0}},
+  { 7, 7,{ 70,  0}},{ 7, 7,{ 70,  0}},{ 7, 7,{ 70,  0}},{ 7, 7,{ 70,  0}},{ 7, 7,{ 70,  0}},
+  { 7, 7,{ 70,  0}},{ 7, 7,{ 70,  0}},{ 7, 7,{ 70,  0}},{ 7, 7,{ 70,  0}},{ 7, 7,{ 70,  0}},
+  { 7, 7,{ 70,  0}},{ 7, 7,{ 70,  0}},{ 7, 7,{ 70,  0}},{ 7, 7,{ 71,  0}},{ 7, 7,{ 71,  0}},
+  { 7, 7,{ 71,  0}},{ 7, 7,{ 71,  0}},{ 7, 7,{ 71,  0}},{ 7, 7,{ 71,  0}},{ 7, 7,{ 71,  0}},
+  { 7, 7,{ 71,  0}},{ 7, 7,{ 71,  0}},{ 7, 7,{ 71,  0}},{ 7, 7,{ 71,  0}},{ 7, 7,{ 71,  0}},
+  { 7, 7,{ 71,  0}},{ 7, 7,{ 71,  0}},{ 7, 7,{ 71,  0}},{ 7, 7,{ 71,  0}},{ 7, 7,{ 72,  0}},
+  { 7, 7,{ 72,  0}},{ 7, 7,{ 72,  0}},{ 7, 7,{ 72,  0}},{ 7, 7,{ 72,  0}},{ 7, 7,{ 72,  0}},
+  { 7, 7,{ 72,  0}},{ 7, 7,{ 72,  0}},{ 7, 7,{ 72,  0}},{ 7, 7,{ 72,  0}},{ 7, 7,{ 72,  0}},
+  { 7, 7,{ 72,  0}},{ 7, 7,{ 72,  0}},{ 7, 7,{ 72,  0}},{ 7, 7,{ 72,  0}},{ 7, 7,{ 72,  0}},
+  { 7, 7,{ 73,  0}},{ 7, 7,{ 73,  0}},{ 7, 7,{ 73,  0}},{ 7, 7,{ 73,  0}},{ 7, 7,{ 73,  0}},
+  { 7, 7,{ 73,  0}},{ 7, 7,{ 73,  0}},{ 7, 7,{ 73,  0}},{ 7, 7,{ 73,  0}},{ 7, 7,{ 73,  0}},
+  { 7, 7,{ 73,  0}},{ 7, 7,{ 73,  0}},{ 7, 7,{ 73,  0}},{ 7, 7,{ 73,  0}},{ 7, 7,{ 73,  0}},
+  { 7, 7,{ 73,  0}},{ 7, 7,{ 74,  0}},{ 7, 7,{ 74,  0}},{ 7, 7,{ 74,  0}},{ 7, 7,{ 74,  0}},
+  { 7, 7,{ 74,  0}},{ 7, 7,{ 74,  0}},{ 7, 7,{ 74,  0}},{ 7, 7,{ 74,  0}},{ 7, 7,{ 74,  0}},
+  { 7, 7,{ 74,  0}},{ 7, 7,{ 74,  0}},{ 7, 7,{ 74,  0}},{ 7, 7,{ 74,  0}},{ 7, 7,{ 74,  0}},
+  { 7, 7,{ 74,  0}},{ 7, 7,{ 74,  0}},{ 7, 7,{ 75,  0}},{ 7, 7,{ 75,  0}},{ 7, 7,{ 75,  0}},
+  { 7, 7,{ 75,  0}},{ 7, 7,{ 75,  0}},{ 7, 7,{ 75,  0}},{ 7, 7,{ 75,  0}},{ 7, 7,{ 75,  0}},
+  { 7, 7,{ 75,  0}},{ 7, 7,{ 75,  0}},{ 7, 7,{ 75,  0}},{ 7, 7,{ 75,  0}},{ 7, 7,{ 75,  0}},
+  { 7, 7,{ 75,  0}},{ 7, 7,{ 75,  0}},{ 7, 7,{ 75,  0}},{ 7, 7,{ 76,  0}},{ 7, 7,{ 76,  0}},
+  { 7, 7,{ 76,  0}},{ 7, 7,{ 76,  0}},{ 7, 7,{ 76,  0}},{ 7, 7,{ 76,  0}},{ 7, 7,{ 76,  0}},
+  { 7, 7,{ 76,  0}},{ 7, 7,{ 76,  0}},{ 7, 7,{ 76,  0}},{ 7, 7,{ 76,  0}},{ 7, 7,{ 76,  0}},
+  { 7, 7,{ 76,  0}},{ 7, 7,{ 76,  0}},{ 7, 7,{ 76,  0}},{ 7, 7,{ 76,  0}},{ 7, 7,{ 77,  0}},
+  { 7, 7,{ 77,  0}},{ 7, 7,{ 77,  0}},{ 7, 7,{ 77,  0}},{ 7, 7,{ 77,  0}},{ 7, 7,{ 77,  0}},
+  { 7, 7,{ 77,  0}},{ 7, 7,{ 77,  0}},{ 7, 7,{ 77,  0}},{ 7, 7,{ 77,  0}},{ 7, 7,{ 77,  0}},
+  { 7, 7,{ 77,  0}},{ 7, 7,{ 77,  0}},{ 7, 7,{ 77,  0}},{ 7, 7,{ 77,  0}},{ 7, 7,{ 77,  0}},
+  { 7, 7,{ 78,  0}},{ 7, 7,{ 78,  0}},{ 7, 7,{ 78,  0}},{ 7, 7,{ 78,  0}},{ 7, 7,{ 78,  0}},
+  { 7, 7,{ 78,  0}},{ 7, 7,{ 78,  0}},{ 7, 7,{ 78,  0}},{ 7, 7,{ 78,  0}},{ 7, 7,{ 78,  0}},
+  { 7, 7,{ 78,  0}},{ 7, 7,{ 78,  0}},{ 7, 7,{ 78,  0}},{ 7, 7,{ 78,  0}},{ 7, 7,{ 78,  0}},
+  { 7, 7,{ 78,  0}},{ 7, 7,{ 79,  0}},{ 7, 7,{ 79,  0}},{ 7, 7,{ 79,  0}},{ 7, 7,{ 79,  0}},
+  { 7, 7,{ 79,  0}},{ 7, 7,{ 79,  0}},{ 7, 7,{ 79,  0}},{ 7, 7,{ 79,  0}},{ 7, 7,{ 79,  0}},
+  { 7, 7,{ 79,  0}},{ 7, 7,{ 79,  0}},{ 7, 7,{ 79,  0}},{ 7, 7,{ 79,  0}},{ 7, 7,{ 79,  0}},
+  { 7, 7,{ 79,  0}},{ 7, 7,{ 79,  0}},{ 7, 7,{ 80,  0}},{ 7, 7,{ 80,  0}},{ 7, 7,{ 80,  0}},
+  { 7, 7,{ 80,  0}},{ 7, 7,{ 80,  0}},{ 7, 7,{ 80,  0}},{ 7, 7,{ 80,  0}},{ 7, 7,{ 80,  0}},
+  { 7, 7,{ 80,  0}},{ 7, 7,{ 80,  0}},{ 7, 7,{ 80,  0}},{ 7, 7,{ 80,  0}},{ 7, 7,{ 80,  0}},
+  { 7, 7,{ 80,  0}},{ 7, 7,{ 80,  0}},{ 7, 7,{ 80,  0}},{ 7, 7,{ 81,  0}},{ 7, 7,{ 81,  0}},
+  { 7, 7,{ 81,  0}},{ 7, 7,{ 81,  0}},{ 7, 7,{ 81,  0}},{ 7, 7,{ 81,  0}},{ 7, 7,{ 81,  0}},
+  { 7, 7,{ 81,  0}},{ 7, 7,{ 81,  0}},{ 7, 7,{ 81,  0}},{ 7, 7,{ 81,  0}},{ 7, 7,{ 81,  0}},
+  { 7, 7,{ 81,  0}},{ 7, 7,{ 81,  0}},{ 7, 7,{ 81,  0}},{ 7, 7,{ 81,  0}},{ 7, 7,{ 82,  0}},
+  { 7, 7,{ 82,  0}},{ 7, 7,{ 82,  0}},{ 7, 7,{ 82,  0}},{ 7, 7,{ 82,  0}},{ 7, 7,{ 82,  0}},
+  { 7, 7,{ 82,  0}},{ 7, 7,{ 82,  0}},{ 7, 7,{ 82,  0}},{ 7, 7,{ 82,  0}},{ 7, 7,{ 82,  0}},
+  { 7, 7,{ 82,  0}},{ 7, 7,{ 82,  0}},{ 7, 7,{ 82,  0}},{ 7, 7,{ 82,  0}},{ 7, 7,{ 82,  0}},
+  { 7, 7,{ 83,  0}},{ 7, 7,{ 83,  0}},{ 7, 7,{ 83,  0}},{ 7, 7,{ 83,  0}},{ 7, 7,{ 83,  0}},
+  { 7, 7,{ 83,  0}},{ 7, 7,{ 83,  0}},{ 7, 7,{ 83,  0}},{ 7, 7,{ 83,  0}},{ 7, 7,{ 83,  0}},
+  { 7, 7,{ 83,  0}},{ 7, 7,{ 83,  0}},{ 7, 7,{ 83,  0}},{ 7, 7,{ 83,  0}},{ 7, 7,{ 83,  0}},
+  { 7, 7,{ 83,  0}},{ 7, 7,{ 84,  0}},{ 7, 7,{ 84,  0}},{ 7, 7,{ 84,  0}},{ 7, 7,{ 84,  0}},
+  { 7, 7,{ 84,  0}},{ 7, 7,{ 84,  0}},{ 7, 7,{ 84,  0}},{ 7, 7,{ 84,  0}},{ 7, 7,{ 84,  0}},
+  { 7, 7,{ 84,  0}},{ 7, 7,{ 84,  0}},{ 7, 7,{ 84,  0}},{ 7, 7,{ 84,  0}},{ 7, 7,{ 84,  0}},
+  { 7, 7,{ 84,  0}},{ 7, 7,{ 84,  0}},{ 7, 7,{ 85,  0}},{ 7, 7,{ 85,  0}},{ 7, 7,{ 85,  0}},
+  { 7, 7,{ 85,  0}},{ 7, 7,{ 85,  0}},{ 7, 7,{ 85,  0}},{ 7, 7,{ 85,  0}},{ 7, 7,{ 85,  0}},
+  { 7, 7,{ 85,  0}},{ 7, 7,{ 85,  0}},{ 7, 7,{ 85,  0}},{ 7, 7,{ 85,  0}},{ 7, 7,{ 85,  0}},
+  { 7, 7,{ 85,  0}},{ 7, 7,{ 85,  0}},{ 7, 7,{ 85,  0}},{ 7, 7,{ 86,  0}},{ 7, 7,{ 86,  0}},
+  { 7, 7,{ 86,  0}},{ 7, 7,{ 86,  0}},{ 7, 7,{ 86,  0}},{ 7, 7,{ 86,  0}},{ 7, 7,{ 86,  0}},
+  { 7, 7,{ 86,  0}},{ 7, 7,{ 86,  0}},{ 7, 7,{ 86,  0}},{ 7, 7,{ 86,  0}},{ 7, 7,{ 86,  0}},
+  { 7, 7,{ 86,  0}},{ 7, 7,{ 86,  0}},{ 7, 7,{ 86,  0}},{ 7, 7,{ 86,  0}},{ 7, 7,{ 87,  0}},
+  { 7, 7,{ 87,  0}},{ 7, 7,{ 87,  0}},{ 7, 7,{ 87,  0}},{ 7, 7,{ 87,  0}},{ 7, 7,{ 87,  0}},
+  { 7, 7,{ 87,  0}},{ 7, 7,{ 87,  0}},{ 7, 7,{ 87,  0}},{ 7, 7,{ 87,  0}},{ 7, 7,{ 87,  0}},
+  { 7, 7,{ 87,  0}},{ 7, 7,{ 87,  0}},{ 7, 7,{ 87,  0}},{ 7, 7,{ 87,  0}},{ 7, 7,{ 87,  0}},
+  { 7, 7,{ 89,  0}},{ 7, 7,{ 89,  0}},{ 7, 7,{ 89,  0}},{ 7, 7,{ 89,  0}},{ 7, 7,{ 89,  0}},
+  { 7, 7,{ 89,  0}},{ 7, 7,{ 89,  0}},{ 7, 7,{ 89,  0}},{ 7, 7,{ 89,  0}},{ 7, 7,{ 89,  0}},
+  { 7, 7,{ 89,  0}},{ 7, 7,{ 89,  0}},{ 7, 7,{ 89,  0}},{ 7, 7,{ 89,  0}},{ 7, 7,{ 89,  0}},
+  { 7, 7,{ 89,  0}},{ 7, 7,{106,  0}},{ 7, 7,{106,  0}},{ 7, 7,{106,  0}},{ 7, 7,{106,  0}},
+  { 7, 7,{106,  0}},{ 7, 7,{106,  0}},{ 7, 7,{106,  0}},{ 7, 7,{106,  0}},{ 7, 7,{106,  0}},
+  { 7, 7,{106,  0}},{ 7, 7,{106,  0}},{ 7, 7,{106,  0}},{ 7, 7,{106,  0}},{ 7, 7,{106,  0}},
+  { 7, 7,{106,  0}},{ 7, 7,{106,  0}},{ 7, 7,{107,  0}},{ 7, 7,{107,  0}},{ 7, 7,{107,  0}},
+  { 7, 7,{107,  0}},{ 7, 7,{107,  0}},{ 7, 7,{107,  0}},{ 7, 7,{107,  0}},{ 7, 7,{107,  0}},
+  { 7, 7,{107,  0}},{ 7, 7,{107,  0}},{ 7, 7,{107,  0}},{ 7, 7,{107,  0}},{ 7, 7,{107,  0}},
+  { 7, 7,{107,  0}},{ 7, 7,{107,  0}},{ 7, 7,{107,  0}},{ 7, 7,{113,  0}},{ 7, 7,{113,  0}},
+  { 7, 7,{113,  0}},{ 7, 7,{113,  0}},{ 7, 7,{113,  0}},{ 7, 7,{113,  0}},{ 7, 7,{113,  0}},
+  { 7, 7,{113,  0}},{ 7, 7,{113,  0}},{ 7, 7,{113,  0}},{ 7, 7,{113,  0}},{ 7, 7,{113,  0}},
+  { 7, 7,{113,  0}},{ 7, 7,{113,  0}},{ 7, 7,{113,  0}},{ 7, 7,{113,  0}},{ 7, 7,{118,  0}},
+  { 7, 7,{118,  0}},{ 7, 7,{118,  0}},{ 7, 7,{118,  0}},{ 7, 7,{118,  0}},{ 7, 7,{118,  0}},
+  { 7, 7,{118,  0}},{ 7, 7,{118,  0}},{ 7, 7,{118,  0}},{ 7, 7,{118,  0}},{ 7, 7,{118,  0}},
+  { 7, 7,{118,  0}},{ 7, 7,{118,  0}},{ 7, 7,{118,  0}},{ 7, 7,{118,  0}},{ 7, 7,{118,  0}},
+  { 7, 7,{119,  0}},{ 7, 7,{119,  0}},{ 7, 7,{119,  0}},{ 7, 7,{119,  0}},{ 7, 7,{119,  0}},
+  { 7, 7,{119,  0}},{ 7, 7,{119,  0}},{ 7, 7,{119,  0}},{ 7, 7,{119,  0}},{ 7, 7,{119,  0}},
+  { 7, 7,{119,  0}},{ 7, 7,{119,  0}},{ 7, 7,{119,  0}},{ 7, 7,{119,  0}},{ 7, 7,{119,  0}},
+  { 7, 7,{119,  0}},{ 7, 7,{120,  0}},{ 7, 7,{120,  0}},{ 7, 7,{120,  0}},{ 7, 7,{120,  0}},
+  { 7, 7,{120,  0}},{ 7, 7,{120,  0}},{ 7, 7,{120,  0}},{ 7, 7,{120,  0}},{ 7, 7,{120,  0}},
+  { 7, 7,{120,  0}},{ 7, 7,{120,  0}},{ 7, 7,{120,  0}},{ 7, 7,{120,  0}},{ 7, 7,{120,  0}},
+  { 7, 7,{120,  0}},{ 7, 7,{120,  0}},{ 7, 7,{121,  0}},{ 7, 7,{121,  0}},{ 7, 7,{121,  0}},
+  { 7, 7,{121,  0}},{ 7, 7,{121,  0}},{ 7, 7,{121,  0}},{ 7, 7,{121,  0}},{ 7, 7,{121,  0}},
+  { 7, 7,{121,  0}},{ 7, 7,{121,  0}},{ 7, 7,{121,  0}},{ 7, 7,{121,  0}},{ 7, 7,{121,  0}},
+  { 7, 7,{121,  0}},{ 7, 7,{121,  0}},{ 7, 7,{121,  0}},{ 7, 7,{122,  0}},{ 7, 7,{122,  0}},
+  { 7, 7,{122,  0}},{ 7, 7,{122,  0}},{ 7, 7,{122,  0}},{ 7, 7,{122,  0}},{ 7, 7,{122,  0}},
+  { 7, 7,{122,  0}},{ 7, 7,{122,  0}},{ 7, 7,{122,  0}},{ 7, 7,{122,  0}},{ 7, 7,{122,  0}},
+  { 7, 7,{122,  0}},{ 7, 7,{122,  0}},{ 7, 7,{122,  0}},{ 7, 7,{122,  0}},{ 8, 8,{ 38,  0}},
+  { 8, 8,{ 38,  0}},{ 8, 8,{ 38,  0}},{ 8, 8,{ 38,  0}},{ 8, 8,{ 38,  0}},{ 8, 8,{ 38,  0}},
+  { 8, 8,{ 38,  0}},{ 8, 8,{ 38,  0}},{ 8, 8,{ 42,  0}},{ 8, 8,{ 42,  0}},{ 8, 8,{ 42,  0}},
+  { 8, 8,{ 42,  0}},{ 8, 8,{ 42,  0}},{ 8, 8,{ 42,  0}},{ 8, 8,{ 42,  0}},{ 8, 8,{ 42,  0}},
+  { 8, 8,{ 44,  0}},{ 8, 8,{ 44,  0}},{ 8, 8,{ 44,  0}},{ 8, 8,{ 44,  0}},{ 8, 8,{ 44,  0}},
+  { 8, 8,{ 44,  0}},{ 8, 8,{ 44,  0}},{ 8, 8,{ 44,  0}},{ 8, 8,{ 59,  0}},{ 8, 8,{ 59,  0}},
+  { 8, 8,{ 59,  0}},{ 8, 8,{ 59,  0}},{ 8, 8,{ 59,  0}},{ 8, 8,{ 59,  0}},{ 8, 8,{ 59,  0}},
+  { 8, 8,{ 59,  0}},{ 8, 8,{ 88,  0}},{ 8, 8,{ 88,  0}},{ 8, 8,{ 88,  0}},{ 8, 8,{ 88,  0}},
+  { 8, 8,{ 88,  0}},{ 8, 8,{ 88,  0}},{ 8, 8,{ 88,  0}},{ 8, 8,{ 88,  0}},{ 8, 8,{ 90,  0}},
+  { 8, 8,{ 90,  0}},{ 8, 8,{ 90,  0}},{ 8, 8,{ 90,  0}},{ 8, 8,{ 90,  0}},{ 8, 8,{ 90,  0}},
+  { 8, 8,{ 90,  0}},{ 8, 8,{ 90,  0}},{10,10,{ 33,  0}},{10,10,{ 33,  0}},{10,10,{ 34,  0}},
+  {10,10,{ 34,  0}},{10,10,{ 40,  0}},{10,10,{ 40,  0}},{10,10,{ 41,  0}},{10,10,{ 41,  0}},
+  {10,10,{ 63,  0}},{10,10,{ 63,  0}},{11,11,{ 39,  0}},{11,11,{ 43,  0}},{11,11,{124,  0}},
+  { 0, 0,{  0,  0}},{ 0, 0,{  0,  0}},{ 0, 0,{  0,  0}}
+};
+
+static const uint64_t huff_hpack_limit[HUFF_HPACK_MAX_LENGTH + 1] = {
+  0x000000000,0x000000000,0x000000000,0x000000000,0x000000000,0x050000000,
+  0x0b8000000,0x0f8000000,0x0fe000000,0x0fe000000,0x0ff400000,0x0ffa00000,
+  0x0ffc00000,0x0fff00000,0x0fff80000,0x0fffe0000,0x0fffe0000,0x0fffe0000,
+  0x0fffe0000,0x0fffe6000,0x0fffee000,0x0ffff4800,0x0ffffb000,0x0ffffea00,
+  0x0fffff600,0x0fffff800,0x0fffffbc0,0x0fffffe20,0x0fffffff0,0x0fffffff0,
+  0x100000000
+};
+
+static const int32_t huff_hpack_offset[HUFF_HPACK_MAX_LENGTH + 1] = {
+  0,0,0,0,0,0,-10,-56,
+  -180,0,-942,-1963,-4008,-8100,-16290,-32672,
+  0,0,0,-524177,-1048452,-2097010,-4194139,-8388423,
+  -16777020,-33554226,-67108642,-134217489,-268435202,0,-1073741567
+};
+
+static const uint16_t huff_hpack_syms[HUFF_HPACK_SYMS] = {
+   48, 49, 50, 97, 99,101,105,111,115,116, 32, 37, 45, 46, 47, 51,
+   52, 53, 54, 55, 56, 57, 61, 65, 95, 98,100,102,103,104,108,109,
+  110,112,114,117, 58, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76,
+   77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 89,106,107,113,118,
+  119,120,121,122, 38, 42, 44, 59, 88, 90, 33, 34, 40, 41, 63, 39,
+   43,124, 35, 62,  0, 36, 64, 91, 93,126, 94,125, 60, 96,123, 92,
+  195,208,128,130,131,162,184,194,224,226,153,161,167,172,176,177,
+  179,209,216,217,227,229,230,129,132,133,134,136,146,154,156,160,
+  163,164,169,170,173,178,181,185,186,187,189,190,196,198,228,232,
+  233,  1,135,137,138,139,140,141,143,147,149,150,151,152,155,157,
+  158,165,166,168,174,175,180,182,183,188,191,197,231,239,  9,142,
+  144,145,148,159,171,206,215,225,236,237,199,207,234,235,192,193,
+  200,201,202,205,210,213,218,219,238,240,242,243,255,203,204,211,
+  212,214,221,222,223,241,244,245,246,247,248,250,251,252,253,254,
+    2,  3,  4,  5,  6,  7,  8, 11, 12, 14, 15, 16, 17, 18, 19, 20,
+   21, 23, 24, 25, 26, 27, 28, 29, 30, 31,127,220,249, 10, 13, 22,
+  256
+};
+
+/*!
+ * @brief Number of bytes `huff_hpack_encode()` writes for `in`.
+ */
+HUFF_INLINE
+size_t
+huff_hpack_encoded_len(const uint8_t * __restrict in, size_t in_len) {
+  size_t i, bits;
+
+  for (i = bits = 0; i < in_len; i++)
+    bits += huff_hpack_lengths[in[i]];
+
+  return (bits + 7) >> 3;
+}
+
+/*!
+ * @brief Encodes a string literal, last byte is padded with 1s (EOS prefix).
+ *
+ * @param[in]  in       Octets to encode.
+ * @param[in]  in_len   Number of octets.
+ * @param[out] out      Output, see `huff_hpack_encoded_len()`.
+ * @param[in]  out_cap  Output capacity in bytes.
+ * @param[out] out_len  Number of bytes written.
+ *
+ * @return `false` if output is full.
+ */
+HUFF_INLINE
+bool
+huff_hpack_encode(const uint8_t * __restrict in,
+                  size_t                     in_len,
+                  uint8_t       * __restrict out,
+                  size_t                     out_cap,
+                  size_t        * __restrict out_len) {
+  huff_writer_t w;
+  size_t        i;
+  unsigned      pad;
+
+  huff_writer_init(&w, out, out + out_cap);
+
+  for (i = 0; i < in_len; i++) {
+    huff_writer_put_msb(&w, huff_hpack_codes[in[i]], huff_hpack_lengths[in[i]]);
+    if (unlikely(!huff_writer_flush_msb(&w)))
+      goto full;
+  }
+
+  if ((pad = (8 - w.nbits) & 7))
+    huff_writer_put_msb(&w, (1U << pad) - 1, pad);
+
+  if (unlikely(!huff_writer_flush_msb(&w)))
+    goto full;
+
+  *out_len = (size_t)(w.p - out);
+  return true;
+
+full:
+  *out_len = (size_t)(w.p - out);
+  return false;
+}
+
+/*!
+ * @brief Decodes a Huffman string literal.
+ *
+ * Fails on EOS symbol, padding longer than 7 bits or padding which is not
+ * the EOS prefix (all 1s), as RFC 7541 5.2 requires. Input is never read
+ * past `in + in_len`. `in_len * 8 / 5` bytes of output is always enough.
+ *
+ * @param[in]  in       Encoded octets.
+ * @param[in]  in_len   Number of encoded octets.
+ * @param[out] out      Decoded octets.
+ * @param[in]  out_cap  Output capacity in bytes.
+ * @param[out] out_len  Number of decoded octets.
+ *
+ * @return `false` if input is invalid or output is full.
+ */
+HUFF_INLINE
+bool
+huff_hpack_decode(const uint8_t * __restrict in,
+                  size_t                     in_len,
+                  uint8_t       * __restrict out,
+                  size_t                     out_cap,
+                  size_t        * __restrict out_len) {
+  const uint8_t     *p, *end;
+  huff_hpack_entry_t e;
+  uint64_t           bits;
+  uint32_t           w;
+  size_t             o;
+  unsigned           nbits, l;
+  uint_fast16_t      sym;
+
+  p     = in;
+  end   = in + in_len;
+  bits  = 0;
+  nbits = 0;
+  o     = 0;
+
+  for (;;) {
+    /* refill, next bit is MSB */
+    if (likely(end - p >= 8)) {
+      bits  |= huff_load64be(p) >> nbits;
+      p     += (63 - nbits) >> 3;
+      nbits |= 56;
+    } else {
+      while (nbits <= 56 && p < end) {
+        bits  |= (uint64_t)*p++ << (56 - nbits);
+        nbits += 8;
+      }
+    }
+
+    /* any code fits, two symbols fit in output */
+    if (likely(nbits >= HUFF_HPACK_MAX_LENGTH && out_cap - o >= 2)) {
+      do {
+        e = huff_hpack_fast[bits >> (64 - HUFF_HPACK_FAST_BITS)];
+        if (likely(e.len1)) {
+          out[o]     = e.sym[0];
+          out[o + 1] = e.sym[1];
+          o         += 1 + (e.len != e.len1);
+          l          = e.len;
+        } else {
+          w = (uint32_t)(bits >> 32);
+          for (l = HUFF_HPACK_FAST_BITS + 1; w >= huff_hpack_limit[l]; l++);
+          sym = huff_hpack_syms[huff_hpack_offset[l] + (int32_t)(w >> (32 - l))];
+          if (unlikely(sym == HUFF_HPACK_EOS))
+            goto err;
+          out[o++] = (uint8_t)sym;
+        }
+        bits <<= l;
+        nbits -= l;
+      } while (nbits >= HUFF_HPACK_MAX_LENGTH && out_cap - o >= 2);
+      continue;
+    }
+
+    /*
+     * one symbol at a time when output is nearly full or input ended. after
+     * a refill fewer than 30 bits means input ended, bits below nbits are
+     * zero and codes longer than nbits are padding
+     */
+    if (!nbits)
+      break;
+
+    e = huff_hpack_fast[bits >> (64 - HUFF_HPACK_FAST_BITS)];
+    if (e.len1) {
+      if (e.len1 > nbits)
+        break;
+
+      if (unlikely(o >= out_cap))
+        goto err;
+
+      out[o++] = e.sym[0];
+      l        = e.len1;
+    } else {
+      w = (uint32_t)(bits >> 32);
+      for (l = HUFF_HPACK_FAST_BITS + 1; w >= huff_hpack_limit[l]; l++);
+      if (l > nbits)
+        break;
+
+      sym = huff_hpack_syms[huff_hpack_offset[l] + (int32_t)(w >> (32 - l))];
+      if (unlikely(sym == HUFF_HPACK_EOS || o >= out_cap))
+        goto err;
+
+      out[o++] = (uint8_t)sym;
+    }
+    bits <<= l;
+    nbits -= l;
+  }
+
+  *out_len = o;
+
+  /* incomplete code or more than 7 bits of padding */
+  if (unlikely(nbits >= 8))
+    return false;
+
+  /* padding must be the most significant bits of EOS */
+  return (((~bits) >> 56) & 0xFF) >> (8 - nbits) == 0;
+
+err:
+  *out_len = o;
+  return false;
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* huff_hpack_h */
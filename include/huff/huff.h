@@ -90,40 +90,88 @@ typedef __uint128_t big_int_t;
 typedef uintmax_t   big_int_t;
 #endif
 
-#ifdef HUFF_ENABLE_BIG_BITSTREAM
+/*
+ * HUFF_ENABLE_BIG_BITSTREAM: 128-bit reservoir where the compiler has 128-bit
+ * integers (GCC, Clang on 64-bit targets), refills load 16 bytes and keep at
+ * least 120 bits. otherwise it is ignored and the reservoir stays 64-bit.
+ */
+#if defined(HUFF_ENABLE_BIG_BITSTREAM) && defined(__SIZEOF_INT128__)
+#  define HUFF_WIDE_BITSTREAM 1
 typedef big_int_t     bitstream_t;
 #else
 typedef uint_fast64_t bitstream_t;
 #endif
 
+#define HUFF_BITSTREAM_BITS   ((int)(sizeof(bitstream_t) * 8))
+
 /* 15: DEFLATE, 16: JPEG */
 #define HUFF_MAX_CODE_LENGTH  16  /* maximum length (bits) of Huffman codes     */
-#define HUFF_FAST_TABLE_BITS  8   /* number of bits used for fast lookup        */
+#ifndef HUFF_FAST_TABLE_BITS
+#  define HUFF_FAST_TABLE_BITS 10 /* max number of bits used for fast lookup    */
+#endif
 #define HUFF_FAST_TABLE_SIZE  (1U << HUFF_FAST_TABLE_BITS)
 #define HUFF_FAST_SHIFT       (HUFF_MAX_CODE_LENGTH - HUFF_FAST_TABLE_BITS)
 #define HUFF_MAX_CODES        288
 
+/*
+ * worst case number of sub table entries for HUFF_MAX_CODES codes up to
+ * HUFF_MAX_CODE_LENGTH bits (complete or incomplete), like ENOUGH in zlib.
+ * tables built with smaller runtime fast bits may need more, their fast bits
+ * are increased until they fit.
+ */
+#if   HUFF_FAST_TABLE_BITS == 8
+#  define HUFF_SUB_TABLE_SIZE 790
+#elif HUFF_FAST_TABLE_BITS == 9
+#  define HUFF_SUB_TABLE_SIZE 534
+#elif HUFF_FAST_TABLE_BITS == 10
+#  define HUFF_SUB_TABLE_SIZE 408
+#elif HUFF_FAST_TABLE_BITS == 11
+#  define HUFF_SUB_TABLE_SIZE 344
+#elif HUFF_FAST_TABLE_BITS == 12
+#  define HUFF_SUB_TABLE_SIZE 314
+#else
+#  error "HUFF_FAST_TABLE_BITS must be in [8, 12]"
+#endif
+
+#define HUFF_TABLE_ENTRIES    (HUFF_FAST_TABLE_SIZE + HUFF_SUB_TABLE_SIZE)
+
 typedef struct {uint64_t base:16,bits:8,mask:24;} huff_ext_t;
 
+/*
+ * fast table entry, one of:
+ *   len != 0            : symbol, code length is len
+ *   len == 0, sub != 0  : link to sub table at fast[sym] indexed by next sub bits
+ *   len == 0, sub == 0  : slow path (incomplete codes), entry is all zero
+ */
 typedef struct huff_fast_entry_t {
   uint8_t  len;
-  uint8_t  rev;
+  uint8_t  sub;
   uint16_t sym;
 } huff_fast_entry_t;
 
-/* extended fast table entry with extra bits info */
+/*
+ * extended fast table entry with extra bits info, 8 bytes. same kinds as
+ * huff_fast_entry_t, mask of extra bits is (1 << bits) - 1
+ */
 typedef struct huff_fast_entry_ext_t {
-  uint8_t  len;
-  uint8_t  rev;
-  uint16_t sym;
-  uint32_t value;
-  uint32_t mask;
-  uint8_t  total;
+  uint8_t  len;   /* code length                                            */
+  uint8_t  sub;   /* sub table bits for links                               */
+  uint16_t sym;   /* symbol or sub table offset for links                   */
+  uint16_t base;  /* base value                                             */
+  uint8_t  bits;  /* number of extra bits                                   */
+  uint8_t  total; /* len + bits                                             */
 } huff_fast_entry_ext_t;
 
-typedef struct huff_table_t {
-  HUFF_ALIGN(32) huff_fast_entry_t fast[HUFF_FAST_TABLE_SIZE];
+/*
+ * fast table entries are followed by symbols in canonical order, which are
+ * only read by the slow path. tables built by huff_init_*_mem() are right
+ * sized: only nfast entries and syms of n symbols are stored, such tables must
+ * not be copied by value.
+ */
+#define HUFF_SYMS_ENTRIES(entry_size) \
+  ((HUFF_MAX_CODES * sizeof(uint16_t) + (entry_size) - 1) / (entry_size))
 
+typedef struct huff_table_t {
   union {
     uint16_t sentinels[HUFF_MAX_CODE_LENGTH + 1];
     uint16_t maxcode[HUFF_MAX_CODE_LENGTH   + 1];
@@ -134,14 +182,15 @@ typedef struct huff_table_t {
     uint16_t mincode[HUFF_MAX_CODE_LENGTH + 1];
   } HUFF_ALIGN(32);
 
-  /* uint16_t *sym; to allow dynmaic syms if no overhead? */
-  HUFF_ALIGN(32) uint16_t syms[HUFF_MAX_CODES];
+  uint16_t                 nfast; /* fast and sub table entries, syms follow */
+  uint8_t                  bits;  /* fast table bits of this table           */
+
+  HUFF_ALIGN(32) huff_fast_entry_t
+  fast[HUFF_TABLE_ENTRIES + HUFF_SYMS_ENTRIES(sizeof(huff_fast_entry_t))];
 } huff_table_t;
 
 /* extended table for extra bits (e.g length/distance in deflate) */
 typedef struct huff_table_ext_t {
-  HUFF_ALIGN(32) huff_fast_entry_ext_t fast[HUFF_FAST_TABLE_SIZE];
-
   union {
     uint16_t sentinels[HUFF_MAX_CODE_LENGTH + 1];
     uint16_t maxcode[HUFF_MAX_CODE_LENGTH   + 1];
@@ -152,16 +201,46 @@ typedef struct huff_table_ext_t {
     uint16_t mincode[HUFF_MAX_CODE_LENGTH + 1];
   } HUFF_ALIGN(32);
 
-  /* uint16_t *sym; to allow dynmaic syms if no overhead? */
-  HUFF_ALIGN(32) uint16_t syms[HUFF_MAX_CODES];
-  const huff_ext_t       *extras; /* extra bits info                        */
-  int                     offset; /* 257 for lit/len, 0 for dist in deflate */
+  const huff_ext_t        *extras; /* extra bits info                        */
+  int                      offset; /* 257 for lit/len, 0 for dist in deflate */
+  uint16_t                 nfast;  /* fast and sub table entries, syms follow */
+  uint8_t                  bits;   /* fast table bits of this table          */
+
+  HUFF_ALIGN(32) huff_fast_entry_ext_t
+  fast[HUFF_TABLE_ENTRIES + HUFF_SYMS_ENTRIES(sizeof(huff_fast_entry_ext_t))];
 } huff_table_ext_t;
 
+/* symbols in canonical order, stored right after used fast table entries */
+#define huff_table_syms(table)                                                \
+  ((const uint16_t *)(const void *)((table)->fast + (table)->nfast))
+
+/* multi-symbol table: one lookup resolves up to HUFF_MULTI_SYMS short codes */
+#define HUFF_MULTI_SYMS       3
+
+typedef struct huff_fast_entry_multi_t {
+  uint8_t  len;                   /* total length of packed codes           */
+  uint8_t  nsym;                  /* packed symbols, 0: use single table    */
+  uint16_t sym[HUFF_MULTI_SYMS];
+} huff_fast_entry_multi_t;
+
+typedef struct huff_table_multi_t {
+  HUFF_ALIGN(32) huff_fast_entry_multi_t multi[HUFF_FAST_TABLE_SIZE];
+  huff_table_t            single; /* codes which don't fit in fast bits     */
+  uint16_t                stop;   /* symbols >= stop are not followed       */
+} huff_table_multi_t;
+
+#include "stats.h"
 #include "read.h"
 #include "rev.h"
+#include "canon.h"
 #include "lsb.h"
 #include "msb.h"
+#include "write.h"
+#include "encode.h"
+#include "stream.h"
+#include "batch.h"
+#include "serial.h"
+#include "cpu.h"
 
 #ifdef __cplusplus
 }
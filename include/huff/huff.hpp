@@ -0,0 +1,434 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * optional C++14 wrapper: table bits, max code length, bit order and extras
+ * are template parameters, so masks and shifts are constants, sub table and
+ * slow path code is left out when codes fit in fast bits and the slow path
+ * is unrolled up to MaxLen. table<>::c is a plain C table, C decoders and
+ * huff_table_save() can be used with it too.
+ *
+ *   using litlen_t = huff::table<huff::order::lsb, 9, 9, true>;
+ *
+ *   constexpr litlen_t litlen = litlen_t::make(lengths, extras, 257);
+ *   static_assert(litlen.valid(), "invalid code");
+ */
+
+#ifndef huff_hpp
+#define huff_hpp
+
+#include "huff.h"
+#include <type_traits>
+
+#if !defined(_MSVC_LANG) && __cplusplus < 201402L
+#  error "huff.hpp needs C++14"
+#endif
+
+#if defined(_MSC_VER)
+#  define HUFF_CXX_INLINE __forceinline
+#  define HUFF_CXX_COLD   __declspec(noinline)
+#else
+#  define HUFF_CXX_INLINE inline __attribute((always_inline))
+#  define HUFF_CXX_COLD   __attribute((noinline, cold))
+#endif
+
+namespace huff {
+
+enum class order { lsb, msb };
+
+namespace detail {
+
+constexpr uint16_t
+rev(uint16_t v, unsigned len) {
+  uint16_t r = 0;
+  for (unsigned i = 0; i < len; i++)
+    r = (uint16_t)(r << 1 | ((v >> i) & 1));
+  return r;
+}
+
+/*
+ * first length in [L, MaxLen] with code < sentinels[l], same result as
+ * huff_code_length() but unrolled for a known max length
+ */
+template <unsigned L, unsigned MaxLen, bool End = (L > MaxLen)>
+struct code_length {
+  static HUFF_CXX_INLINE unsigned
+  get(const uint16_t *sentinels, uint32_t w) {
+    return (w >> (HUFF_MAX_CODE_LENGTH - L)) < sentinels[L]
+           ? L : code_length<L + 1, MaxLen>::get(sentinels, w);
+  }
+};
+
+template <unsigned L, unsigned MaxLen>
+struct code_length<L, MaxLen, true> {
+  static HUFF_CXX_INLINE unsigned
+  get(const uint16_t *, uint32_t) { return 0; }
+};
+
+} /* namespace detail */
+
+template <order    Order,
+          unsigned FastBits = HUFF_FAST_TABLE_BITS,
+          unsigned MaxLen   = HUFF_MAX_CODE_LENGTH,
+          bool     Extras   = false>
+struct table {
+  static_assert(FastBits >= 1 && FastBits <= HUFF_FAST_TABLE_BITS,
+                "FastBits must be in [1, HUFF_FAST_TABLE_BITS]");
+  static_assert(MaxLen >= 1 && MaxLen <= HUFF_MAX_CODE_LENGTH,
+                "MaxLen must be in [1, HUFF_MAX_CODE_LENGTH]");
+  static_assert(!Extras || Order == order::lsb,
+                "extended tables are LSB-first");
+
+  using c_type = typename std::conditional<Extras, huff_table_ext_t,
+                                           huff_table_t>::type;
+  using entry  = typename std::conditional<Extras, huff_fast_entry_ext_t,
+                                           huff_fast_entry_t>::type;
+
+  static constexpr unsigned fast_bits = FastBits;
+  static constexpr unsigned max_len   = MaxLen;
+  static constexpr unsigned sub_bits  = MaxLen > FastBits ? MaxLen - FastBits : 0;
+
+  /* symbols per refill of at least HUFF_REFILL_BITS bits */
+  static constexpr unsigned per_refill = HUFF_REFILL_BITS / MaxLen;
+
+  c_type c;
+
+  /*!
+   * @brief true if table is built with FastBits, e.g. by make() of a valid
+   *        code. check with static_assert() for constexpr tables.
+   */
+  constexpr bool
+  valid() const { return c.bits == FastBits && c.nfast; }
+
+  /*!
+   * @brief Builds a table at runtime by C builders.
+   *
+   * @return false if a length is above MaxLen or FastBits would have to be
+   *         increased for sub tables to fit.
+   */
+  template <bool E = Extras, typename std::enable_if<!E, int>::type = 0>
+  bool
+  init(const uint8_t * __restrict lengths, uint16_t n) {
+    if (!check(lengths, n))
+      return false;
+
+    if (Order == order::lsb)
+      return huff_init_lsb_bits(&c, lengths, NULL, n, FastBits) && valid();
+    return huff_init_msb_bits(&c, lengths, NULL, n, FastBits) && valid();
+  }
+
+  /*!
+   * @brief Same as `init()` for extended tables, see `huff_init_lsb_extof()`.
+   */
+  template <bool E = Extras, typename std::enable_if<E, int>::type = 0>
+  bool
+  init(const uint8_t    * __restrict lengths,
+       uint16_t                      n,
+       const huff_ext_t * __restrict extras,
+       int                           offset = 0) {
+    return check(lengths, n)
+           && huff_init_lsb_extof_bits(&c, lengths, NULL, extras, offset, n,
+                                       FastBits)
+           && valid();
+  }
+
+  /*!
+   * @brief Builds a table at compile time, e.g. for fixed codes.
+   *
+   * Sub tables have MaxLen - FastBits bits, all codes are resolved by fast or
+   * sub table entries so the slow path only sees invalid codes and symbols
+   * after fast entries are not stored. Over-subscribed codes, lengths above
+   * MaxLen or sub tables which don't fit give a table which is not `valid()`.
+   */
+  template <size_t N>
+  static constexpr table
+  make(const uint8_t (&lengths)[N],
+       const huff_ext_t *extras = nullptr,
+       int               offset = 0) {
+    static_assert(N <= HUFF_MAX_CODES, "too many symbols");
+
+    /* C++14 constexpr locals must be initialized */
+    table    t{};
+    uint32_t count[HUFF_MAX_CODE_LENGTH + 1] = {0};
+    uint32_t next[HUFF_MAX_CODE_LENGTH + 1]  = {0};
+    uint32_t code = 0, pos = 0, nfast = 0, l = 0, i = 0, k = 0, c = 0, rl = 0,
+             idx = 0, link = 0, prefix = 0, fill = 0;
+    entry    fe{};
+
+    for (i = 0; i < N; i++) {
+      if (lengths[i] > MaxLen)
+        return t;
+      count[lengths[i]]++;
+    }
+
+    /* same canonical order, sentinels and offsets as huff_canonical() */
+    count[0] = code = pos = 0;
+    for (l = 1; l <= HUFF_MAX_CODE_LENGTH; l++) {
+      code  = (code + count[l - 1]) << 1;
+      pos  += count[l - 1];
+      next[l] = code;
+
+      if (code + count[l] > (1U << l))
+        return t;
+
+      t.c.sentinels[l] = (uint16_t)(code + count[l]);
+      t.c.offsets[l]   = (uint16_t)(pos - code);
+    }
+
+    nfast = 1U << FastBits;
+    for (i = 0; i < N; i++) {
+      if (!(l = lengths[i]))
+        continue;
+
+      c      = next[l]++;
+      fe     = entry{};
+      fe.len = (uint8_t)l;
+      fe.sym = (uint16_t)i;
+      set_extras(fe, extras, offset);
+
+      if (l <= FastBits) {
+        fill = 1U << (FastBits - l);
+        for (k = 0; k < fill; k++) {
+          idx = Order == order::lsb ? detail::rev((uint16_t)c, l) | k << l
+                                    : c << (FastBits - l) | k;
+          t.c.fast[idx] = fe;
+        }
+        continue;
+      }
+
+      /* link first level entry of the prefix to a sub table */
+      prefix = c >> (l - FastBits);
+      link   = Order == order::lsb ? detail::rev((uint16_t)prefix, FastBits)
+                                   : prefix;
+      if (!t.c.fast[link].sub) {
+        if (nfast + (1U << sub_bits) > HUFF_TABLE_ENTRIES)
+          return t;
+
+        t.c.fast[link].sub = (uint8_t)sub_bits;
+        t.c.fast[link].sym = (uint16_t)nfast;
+        nfast += 1U << sub_bits;
+      }
+
+      rl   = l - FastBits;
+      c   &= (1U << rl) - 1;
+      fill = 1U << (sub_bits - rl);
+      for (k = 0; k < fill; k++) {
+        idx = Order == order::lsb ? detail::rev((uint16_t)c, rl) | k << rl
+                                  : c << (sub_bits - rl) | k;
+        t.c.fast[t.c.fast[link].sym + idx] = fe;
+      }
+    }
+
+    set_table(t.c, extras, offset);
+    t.c.nfast = (uint16_t)nfast;
+    t.c.bits  = (uint8_t)FastBits;
+    return t;
+  }
+
+  /*!
+   * @brief Decodes a symbol, next bit is the LSB (LSB-first) or the MSB of
+   *        the window (MSB-first).
+   *
+   * @return symbol, -1 with `used = 0` for an invalid code.
+   */
+  HUFF_CXX_INLINE int
+  decode(bitstream_t bits, uint8_t &used) const {
+    entry fe;
+
+    fe = c.fast[root(bits)];
+    if (likely(fe.len)) {
+      used = length(fe);
+      return fe.sym;
+    }
+
+    if (sub_bits && likely(fe.sub)) {
+      fe = c.fast[fe.sym + sub(bits, fe.sub)];
+      if (likely(fe.len)) {
+        used = length(fe);
+        return fe.sym;
+      }
+    }
+
+    return slow(bits, used);
+  }
+
+  /*!
+   * @brief Decodes a symbol and its extra bits, like `huff_decode_lsb_extof()`.
+   */
+  template <bool E = Extras, typename std::enable_if<E, int>::type = 0>
+  HUFF_CXX_INLINE int
+  decode(bitstream_t bits, uint8_t &used, unsigned &value) const {
+    huff_ext_t ext;
+    entry      fe;
+    int        sym;
+
+    fe = c.fast[root(bits)];
+    if (sub_bits && unlikely(!fe.len && fe.sub))
+      fe = c.fast[fe.sym + sub(bits, fe.sub)];
+
+    if (likely(fe.len)) {
+      used  = fe.total;
+      value = fe.base + ((unsigned)(bits >> fe.len) & ((1U << fe.bits) - 1));
+      return fe.sym;
+    }
+
+    if ((sym = slow(bits, used)) >= c.offset) {
+      ext    = c.extras[sym - c.offset];
+      value  = (unsigned)(ext.base + (ext.mask & (unsigned)(bits >> used)));
+      used  += (uint8_t)ext.bits;
+    } else {
+      value  = 0;
+    }
+
+    return sym;
+  }
+
+  /*!
+   * @brief Same as `huff_decode_lsb_n()`, bits are checked once per
+   *        `per_refill` symbols of at most MaxLen bits.
+   */
+  template <order O = Order,
+            typename std::enable_if<O == order::lsb && !Extras, int>::type = 0>
+  HUFF_CXX_INLINE size_t
+  decode_n(huff_reader_t * __restrict reader,
+           uint16_t      * __restrict out,
+           size_t                     count) const {
+    huff_reader_t r;
+    size_t        i;
+    unsigned      j;
+    uint8_t       used;
+    int           sym;
+
+    r = *reader;
+    i = 0;
+
+    while (i < count) {
+      huff_reader_refill(&r);
+
+      if (likely(r.nbits >= per_refill * MaxLen && count - i >= per_refill)) {
+        for (j = 0; j < per_refill; j++) {
+          sym = decode(r.bits, used);
+          if (unlikely(!used)) {
+            r.err = r.err ? r.err : HUFF_ERR_CODE;
+            goto done;
+          }
+
+          out[i++] = (uint16_t)sym;
+          huff_reader_consume(&r, used);
+        }
+        continue;
+      }
+
+      /* tail: input is about to end or a few symbols are left */
+      sym = decode(r.bits, used);
+      if (!used || used > r.nbits) {
+        if (!used && r.nbits >= MaxLen)
+          r.err = r.err ? r.err : HUFF_ERR_CODE;
+        break;
+      }
+
+      out[i++] = (uint16_t)sym;
+      huff_reader_consume(&r, used);
+    }
+
+  done:
+    *reader = r;
+    return i;
+  }
+
+private:
+  static bool
+  check(const uint8_t * __restrict lengths, uint16_t n) {
+    uint16_t i;
+    for (i = 0; i < n; i++)
+      if (lengths[i] > MaxLen)
+        return false;
+    return n <= HUFF_MAX_CODES;
+  }
+
+  static HUFF_CXX_INLINE uint_fast16_t
+  root(bitstream_t bits) {
+    if (Order == order::lsb)
+      return (uint_fast16_t)bits & ((1U << FastBits) - 1);
+    return (uint_fast16_t)(bits >> (HUFF_BITSTREAM_BITS - FastBits));
+  }
+
+  static HUFF_CXX_INLINE uint_fast16_t
+  sub(bitstream_t bits, unsigned n) {
+    if (Order == order::lsb)
+      return (uint_fast16_t)(bits >> FastBits) & ((1U << n) - 1);
+    return (uint_fast16_t)((bits << FastBits) >> (HUFF_BITSTREAM_BITS - n));
+  }
+
+  static HUFF_CXX_INLINE uint8_t
+  length(const huff_fast_entry_t &fe) { return fe.len; }
+
+  static HUFF_CXX_INLINE uint8_t
+  length(const huff_fast_entry_ext_t &fe) { return fe.total; }
+
+  /* only invalid codes or codes of sub tables which didn't fit */
+  HUFF_CXX_COLD int
+  slow(bitstream_t bits, uint8_t &used) const {
+    uint32_t w;
+    unsigned l;
+
+    if (MaxLen <= FastBits) {
+      used = 0;
+      return -1;
+    }
+
+    if (Order == order::lsb)
+      w = huff_rev16((uint16_t)bits, 16);
+    else
+      w = (uint16_t)(bits >> (HUFF_BITSTREAM_BITS - 16));
+
+    l = detail::code_length<FastBits + 1, MaxLen>::get(c.sentinels, w);
+    if (!l) {
+      used = 0;
+      return -1;
+    }
+
+    used = (uint8_t)l;
+    return huff_table_syms(&c)[(uint16_t)(c.offsets[l]
+                                          + (w >> (HUFF_MAX_CODE_LENGTH - l)))];
+  }
+
+  static constexpr void
+  set_extras(huff_fast_entry_t &, const huff_ext_t *, int) {}
+
+  static constexpr void
+  set_extras(huff_fast_entry_ext_t &fe, const huff_ext_t *extras, int offset) {
+    if (extras && (int)fe.sym >= offset) {
+      fe.base = (uint16_t)extras[fe.sym - offset].base;
+      fe.bits = (uint8_t)extras[fe.sym - offset].bits;
+    }
+    fe.total = (uint8_t)(fe.len + fe.bits);
+  }
+
+  static constexpr void
+  set_table(huff_table_t &, const huff_ext_t *, int) {}
+
+  static constexpr void
+  set_table(huff_table_ext_t &t, const huff_ext_t *extras, int offset) {
+    t.extras = extras;
+    t.offset = offset;
+  }
+};
+
+} /* namespace huff */
+
+#endif /* huff_hpp */
@@ -0,0 +1,463 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * JPEG (ITU T.81) entropy decoding. Codes are MSB-first, symbols are
+ * run << 4 | size for AC and size for DC tables. A lookup of
+ * HUFF_JPEG_FAST_BITS resolves the code and, if its magnitude bits fit in the
+ * same window, the sign extended coefficient (RECEIVE + EXTEND), like the
+ * lookahead table of libjpeg-turbo's jdhuff. Longer codes use an MSB table of
+ * huff_init_msb().
+ *
+ * The reader removes 0xFF00 byte stuffing and stops at markers, zero bits are
+ * supplied after a marker or end of input.
+ */
+
+#ifndef huff_jpeg_h
+#define huff_jpeg_h
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "huff.h"
+
+#ifndef HUFF_JPEG_FAST_BITS
+#  define HUFF_JPEG_FAST_BITS  10
+#endif
+
+#define HUFF_JPEG_MAX_BITS     32   /* code + magnitude bits of a coefficient */
+#define HUFF_JPEG_MORE         0x80 /* entry flag: magnitude bits follow      */
+
+/*
+ * fast table entry, one of:
+ *   len                      : code and magnitude bits, value is resolved
+ *   len | HUFF_JPEG_MORE     : code length, sym & 15 magnitude bits follow
+ *   HUFF_JPEG_MORE           : code is longer than HUFF_JPEG_FAST_BITS
+ */
+typedef struct huff_jpeg_entry_t {
+  int16_t value; /* sign extended coefficient                              */
+  uint8_t sym;   /* run << 4 | size                                        */
+  uint8_t len;   /* bits to consume, see above                             */
+} huff_jpeg_entry_t;
+
+typedef struct huff_jpeg_table_t {
+  HUFF_ALIGN(32) huff_jpeg_entry_t fast[1U << HUFF_JPEG_FAST_BITS];
+  huff_table_t             table; /* code positions, long codes only    */
+  uint8_t                  syms[256];
+} huff_jpeg_table_t;
+
+/* entropy coded segment reader, bits are consumed from MSB */
+typedef struct huff_jpeg_reader_t {
+  const uint8_t *p;      /* next byte to load, 0xFF of marker if found      */
+  const uint8_t *end;    /* end of input                                    */
+  uint64_t       bits;   /* reservoir, next bit is MSB                      */
+  unsigned       nbits;  /* number of valid bits in reservoir               */
+  unsigned       pad;    /* zero bytes added after marker or end            */
+  unsigned       marker; /* marker code which ended the segment, 0 if none  */
+  unsigned       err;    /* first error, HUFF_OK if none                    */
+} huff_jpeg_reader_t;
+
+/* zigzag index to natural (row-major) index of 8x8 block */
+static const uint8_t huff_jpeg_natural[64] = {
+   0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+  12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+  35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+  58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+};
+
+/* typical tables of T.81 Annex K.3, e.g. for Motion JPEG without DHT */
+static const uint8_t huff_jpeg_dc_luma_counts[16] = {
+  0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const uint8_t huff_jpeg_dc_chroma_counts[16] = {
+  0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0
+};
+
+static const uint8_t huff_jpeg_dc_syms[12] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11
+};
+
+static const uint8_t huff_jpeg_ac_luma_counts[16] = {
+  0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d
+};
+
+static const uint8_t huff_jpeg_ac_luma_syms[162] = {
+  0x01,0x02,0x03,0x00,0x04,0x11,0x05,0x12,0x21,0x31,0x41,0x06,0x13,0x51,0x61,0x07,
+  0x22,0x71,0x14,0x32,0x81,0x91,0xa1,0x08,0x23,0x42,0xb1,0xc1,0x15,0x52,0xd1,0xf0,
+  0x24,0x33,0x62,0x72,0x82,0x09,0x0a,0x16,0x17,0x18,0x19,0x1a,0x25,0x26,0x27,0x28,
+  0x29,0x2a,0x34,0x35,0x36,0x37,0x38,0x39,0x3a,0x43,0x44,0x45,0x46,0x47,0x48,0x49,
+  0x4a,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x63,0x64,0x65,0x66,0x67,0x68,0x69,
+  0x6a,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x83,0x84,0x85,0x86,0x87,0x88,0x89,
+  0x8a,0x92,0x93,0x94,0x95,0x96,0x97,0x98,0x99,0x9a,0xa2,0xa3,0xa4,0xa5,0xa6,0xa7,
+  0xa8,0xa9,0xaa,0xb2,0xb3,0xb4,0xb5,0xb6,0xb7,0xb8,0xb9,0xba,0xc2,0xc3,0xc4,0xc5,
+  0xc6,0xc7,0xc8,0xc9,0xca,0xd2,0xd3,0xd4,0xd5,0xd6,0xd7,0xd8,0xd9,0xda,0xe1,0xe2,
+  0xe3,0xe4,0xe5,0xe6,0xe7,0xe8,0xe9,0xea,0xf1,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,0xf8,
+  0xf9,0xfa
+};
+
+static const uint8_t huff_jpeg_ac_chroma_counts[16] = {
+  0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77
+};
+
+static const uint8_t huff_jpeg_ac_chroma_syms[162] = {
+  0x00,0x01,0x02,0x03,0x11,0x04,0x05,0x21,0x31,0x06,0x12,0x41,0x51,0x07,0x61,0x71,
+  0x13,0x22,0x32,0x81,0x08,0x14,0x42,0x91,0xa1,0xb1,0xc1,0x09,0x23,0x33,0x52,0xf0,
+  0x15,0x62,0x72,0xd1,0x0a,0x16,0x24,0x34,0xe1,0x25,0xf1,0x17,0x18,0x19,0x1a,0x26,
+  0x27,0x28,0x29,0x2a,0x35,0x36,0x37,0x38,0x39,0x3a,0x43,0x44,0x45,0x46,0x47,0x48,
+  0x49,0x4a,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x63,0x64,0x65,0x66,0x67,0x68,
+  0x69,0x6a,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x82,0x83,0x84,0x85,0x86,0x87,
+  0x88,0x89,0x8a,0x92,0x93,0x94,0x95,0x96,0x97,0x98,0x99,0x9a,0xa2,0xa3,0xa4,0xa5,
+  0xa6,0xa7,0xa8,0xa9,0xaa,0xb2,0xb3,0xb4,0xb5,0xb6,0xb7,0xb8,0xb9,0xba,0xc2,0xc3,
+  0xc4,0xc5,0xc6,0xc7,0xc8,0xc9,0xca,0xd2,0xd3,0xd4,0xd5,0xd6,0xd7,0xd8,0xd9,0xda,
+  0xe2,0xe3,0xe4,0xe5,0xe6,0xe7,0xe8,0xe9,0xea,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,0xf8,
+  0xf9,0xfa
+};
+
+/*!
+ * @brief EXTEND of T.81 F.2.2.1, `size` magnitude bits to a signed value.
+ */
+HUFF_INLINE
+int
+huff_jpeg_extend(unsigned v, unsigned size) {
+  return (int)v - (v < (1U << size >> 1) ? (int)(1U << size) - 1 : 0);
+}
+
+/*!
+ * @brief Builds a table from DHT counts (BITS) and symbols (HUFFVAL).
+ *
+ * DC symbols must be sizes up to 15, AC symbols are run << 4 | size.
+ *
+ * @param[out]  table    Table to initialize.
+ * @param[in]   counts   Number of codes of each length 1..16.
+ * @param[in]   symbols  Symbols in code order.
+ *
+ * @return `false` if there are no codes, more than 256 codes or the code is
+ *         over-subscribed.
+ */
+HUFF_INLINE
+bool
+huff_jpeg_init(huff_jpeg_table_t * __restrict table,
+               const uint8_t     * __restrict counts,
+               const uint8_t     * __restrict symbols) {
+  huff_jpeg_entry_t e, slow;
+  uint8_t           lengths[256];
+  unsigned          l, i, n, k, s, idx, rest, size;
+
+  for (l = 1, n = 0; l <= HUFF_MAX_CODE_LENGTH; l++) {
+    if (n + counts[l - 1] > 256)
+      return false;
+    for (i = 0; i < counts[l - 1]; i++)
+      lengths[n++] = (uint8_t)l;
+  }
+
+  /* symbols of long codes are found by position in code order */
+  if (!n || !huff_init_msb_checked(&table->table, lengths, NULL, (uint16_t)n,
+                                   HUFF_FAST_BITS_AUTO, true))
+    return false;
+
+  memcpy(table->syms, symbols, n);
+
+  slow.value = 0;
+  slow.sym   = 0;
+  slow.len   = HUFF_JPEG_MORE;
+
+  /* canonical codes are contiguous in code order, starting at 0 */
+  for (l = 1, k = idx = 0; l <= HUFF_JPEG_FAST_BITS; l++) {
+    rest = HUFF_JPEG_FAST_BITS - l;
+
+    for (i = 0; i < counts[l - 1]; i++, k++) {
+      e.sym = symbols[k];
+      size  = e.sym & 15;
+
+      for (s = 0; s < 1U << rest; s++) {
+        if (l + size <= HUFF_JPEG_FAST_BITS) {
+          e.len   = (uint8_t)(l + size);
+          e.value = (int16_t)(size ? huff_jpeg_extend(s >> (rest - size), size)
+                                   : 0);
+        } else {
+          e.len   = (uint8_t)(l | HUFF_JPEG_MORE);
+          e.value = 0;
+        }
+        table->fast[idx++] = e;
+      }
+    }
+  }
+
+  /* longer codes and unused code space */
+  while (idx < 1U << HUFF_JPEG_FAST_BITS)
+    table->fast[idx++] = slow;
+
+  return true;
+}
+
+HUFF_INLINE
+void
+huff_jpeg_reader_init(huff_jpeg_reader_t * __restrict reader,
+                      const uint8_t      * __restrict buff,
+                      const uint8_t      * __restrict end) {
+  reader->p      = buff;
+  reader->end    = end;
+  reader->bits   = 0;
+  reader->nbits  = 0;
+  reader->pad    = 0;
+  reader->marker = 0;
+  reader->err    = HUFF_OK;
+}
+
+/* byte by byte refill near 0xFF bytes, markers and end of input */
+HUFF_INLINE
+void
+huff_jpeg_refill_slow(huff_jpeg_reader_t * __restrict reader) {
+  const uint8_t *q;
+  unsigned       c;
+
+  while (reader->nbits < 56) {
+    if (reader->marker || reader->p >= reader->end) {
+      reader->pad++;
+      reader->nbits += 8;
+      continue;
+    }
+
+    c = *reader->p;
+    if (unlikely(c == 0xFF)) {
+      /* 0xFF 0x00 is a 0xFF data byte, otherwise (fill bytes and) marker */
+      for (q = reader->p + 1; q < reader->end && *q == 0xFF; q++);
+
+      if (q >= reader->end) {
+        reader->p = reader->end;
+        continue;
+      }
+
+      if (*q) {
+        reader->marker = *q;
+        reader->p      = q - 1;
+        continue;
+      }
+
+      reader->p = q;
+    }
+
+    reader->bits  |= (uint64_t)c << (56 - reader->nbits);
+    reader->nbits += 8;
+    reader->p++;
+  }
+}
+
+/*!
+ * @brief Refills the reservoir to at least 56 bits, zero bits are supplied
+ *        after a marker or end of input.
+ *
+ * A single 8 byte load is used if none of the next 8 bytes is 0xFF.
+ */
+HUFF_INLINE
+void
+huff_jpeg_refill(huff_jpeg_reader_t * __restrict reader) {
+  uint64_t v;
+
+  if (likely(reader->end - reader->p >= 8)) {
+    v = huff_load64be(reader->p);
+
+    /* no byte of v is 0xFF: no stuffing, no marker */
+    if (likely(!((~v - 0x0101010101010101ULL) & v & 0x8080808080808080ULL))) {
+      reader->bits  |= v >> reader->nbits;
+      reader->p     += (63 - reader->nbits) >> 3;
+      reader->nbits |= 56;
+      return;
+    }
+  }
+
+  huff_jpeg_refill_slow(reader);
+}
+
+HUFF_INLINE
+void
+huff_jpeg_consume(huff_jpeg_reader_t * __restrict reader, unsigned n) {
+  reader->bits  <<= n;
+  reader->nbits  -= n;
+}
+
+/*!
+ * @brief Returns the first error of a reader: `HUFF_ERR_CODE` for invalid
+ *        codes or coefficient indices, `HUFF_ERR_INPUT` if zero bits after a
+ *        marker or end of input were decoded, otherwise `HUFF_OK`.
+ */
+HUFF_INLINE
+unsigned
+huff_jpeg_reader_status(const huff_jpeg_reader_t * __restrict reader) {
+  if (reader->err)
+    return reader->err;
+
+  return reader->pad * 8 > reader->nbits ? HUFF_ERR_INPUT : HUFF_OK;
+}
+
+/*!
+ * @brief Skips to the next restart interval, remaining bits are dropped.
+ *
+ * @return `false` if the next marker is not RSTn, `reader->marker` is the
+ *         marker found (e.g. EOI) or 0.
+ */
+HUFF_INLINE
+bool
+huff_jpeg_restart(huff_jpeg_reader_t * __restrict reader) {
+  reader->bits  = 0;
+  reader->nbits = 0;
+  reader->pad   = 0;
+
+  /* marker may not be loaded yet */
+  if (!reader->marker)
+    huff_jpeg_refill_slow(reader);
+
+  if ((reader->marker & 0xF8) != 0xD0)
+    return false;
+
+  reader->p     += 2;
+  reader->bits   = 0;
+  reader->nbits  = 0;
+  reader->pad    = 0;
+  reader->marker = 0;
+  return true;
+}
+
+/* codes longer than HUFF_JPEG_FAST_BITS or magnitude bits outside window */
+HUFF_INLINE
+int
+huff_jpeg_decode_slow(const huff_jpeg_table_t * __restrict table,
+                      huff_jpeg_reader_t      * __restrict reader,
+                      huff_jpeg_entry_t                    e,
+                      int                     * __restrict value) {
+  unsigned      len, size;
+  uint_fast16_t k;
+  uint8_t       used;
+
+  len = e.len & ~HUFF_JPEG_MORE;
+  if (!len) {
+    k = huff_decode_msb(&table->table,
+                        (bitstream_t)reader->bits << (HUFF_BITSTREAM_BITS - 64),
+                        16, &used);
+    if (unlikely(!used)) {
+      reader->err   = reader->err ? reader->err : HUFF_ERR_CODE;
+      *value        = 0;
+      return -1;
+    }
+
+    len   = used;
+    e.sym = table->syms[k];
+  }
+
+  huff_jpeg_consume(reader, len);
+
+  size   = e.sym & 15;
+  *value = 0;
+  if (size) {
+    *value = huff_jpeg_extend((unsigned)(reader->bits >> (64 - size)), size);
+    huff_jpeg_consume(reader, size);
+  }
+
+  return e.sym;
+}
+
+/*!
+ * @brief Decodes a symbol and its coefficient (HUFFMAN DECODE + RECEIVE +
+ *        EXTEND), refills the reader when needed.
+ *
+ * @param[in]      table   Table built by `huff_jpeg_init()`.
+ * @param[in, out] reader  Reader, see `huff_jpeg_reader_init()`.
+ * @param[out]     value   Sign extended value of `sym & 15` magnitude bits,
+ *                         0 if there are none.
+ *
+ * @return run << 4 | size for AC, size for DC tables, -1 on invalid code.
+ */
+HUFF_INLINE
+int
+huff_jpeg_decode(const huff_jpeg_table_t * __restrict table,
+                 huff_jpeg_reader_t      * __restrict reader,
+                 int                     * __restrict value) {
+  huff_jpeg_entry_t e;
+
+  if (reader->nbits < HUFF_JPEG_MAX_BITS)
+    huff_jpeg_refill(reader);
+
+  e = table->fast[reader->bits >> (64 - HUFF_JPEG_FAST_BITS)];
+  if (likely(!(e.len & HUFF_JPEG_MORE))) {
+    huff_jpeg_consume(reader, e.len);
+    *value = e.value;
+    return e.sym;
+  }
+
+  return huff_jpeg_decode_slow(table, reader, e, value);
+}
+
+/*!
+ * @brief Decodes a block of a baseline (sequential) scan.
+ *
+ * @param[in]      dc      DC table.
+ * @param[in]      ac      AC table.
+ * @param[in, out] reader  Reader.
+ * @param[in, out] pred    DC predictor of the component, 0 at start of scan
+ *                         and after restart markers.
+ * @param[out]     coef    64 coefficients in natural order, not dequantized.
+ *
+ * @return `false` on invalid code or a run past the end of block, which also
+ *         sets `HUFF_ERR_CODE`.
+ */
+HUFF_INLINE
+bool
+huff_jpeg_decode_block(const huff_jpeg_table_t * __restrict dc,
+                       const huff_jpeg_table_t * __restrict ac,
+                       huff_jpeg_reader_t      * __restrict reader,
+                       int                     * __restrict pred,
+                       int16_t                 * __restrict coef) {
+  unsigned k;
+  int      sym, value;
+
+  memset(coef, 0, 64 * sizeof(*coef));
+
+  if (unlikely(huff_jpeg_decode(dc, reader, &value) < 0))
+    return false;
+
+  *pred  += value;
+  coef[0] = (int16_t)*pred;
+
+  for (k = 1; k < 64; k++) {
+    sym = huff_jpeg_decode(ac, reader, &value);
+    if (unlikely(sym < 0))
+      return false;
+
+    /* EOB: rest is zero, ZRL: 16 zeros */
+    if (!(sym & 15)) {
+      if (sym != 0xF0)
+        break;
+      k += 15;
+      continue;
+    }
+
+    k += (unsigned)sym >> 4;
+    if (unlikely(k > 63)) {
+      reader->err = reader->err ? reader->err : HUFF_ERR_CODE;
+      return false;
+    }
+
+    coef[huff_jpeg_natural[k]] = (int16_t)value;
+  }
+
+  return true;
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* huff_jpeg_h */
@@ -49,83 +49,456 @@ huff_decode_lsb(const huff_table_t * __restrict table,
                 uint8_t                         bit_length,
                 uint8_t            * __restrict used) {
   huff_fast_entry_t fe;
-  uint16_t          code, bits;
-  uint8_t           bits8, l;
+  uint16_t          code;
+  uint8_t           l, fb;
 
   (void)bit_length;
 
   /* align bits so LSB is always in the first position */
-  bits8 = (uint8_t)bitstream;
-  fe    = table->fast[bits8];
+  fb = table->bits;
+  fe = table->fast[(uint_fast16_t)bitstream & ((1U << fb) - 1)];
 
   if (likely(fe.len)) {
+    HUFF_STAT_CODE(fe.len);
     *used = fe.len;
     return fe.sym;
   }
 
-  bits = (uint16_t)(bitstream >> 8);
-  code = fe.rev; /* huff_rev8full(bits8); */
-
-  /* check length and add next bit from LSB to MSB position of our code */
-#define CHECK_LENGTH(l)                                                       \
-  code = (code << 1) | (bits & 1);                                            \
-  if (code < table->sentinels[l]) {                                           \
-    *used=l;return table->syms[(uint16_t)(table->offsets[l]+code)];           \
-  }                                                                           \
-  bits>>=1;
-
-  /*
-#define CHECK_LENGTH(l)                                                       \
-  if (code < table->sentinels[l]) {                                           \
-    *used=l;return table->syms[(uint16_t)(table->offsets[l]+code)];           \
-  } code=(code<<1)|((bits>>=1)&1);
-  */
+  /* sub table, indexed by the next fe.sub bits */
+  if (likely(fe.sub)) {
+    fe = table->fast[fe.sym
+                     + ((uint_fast16_t)(bitstream >> fb) & ((1U << fe.sub) - 1))];
+    HUFF_STAT_SUB(fe.len);
+    if (likely(fe.len)) {
+      HUFF_STAT_CODE(fe.len);
+      *used = fe.len;
+      return fe.sym;
+    }
+  }
 
-  CHECK_LENGTH(9);
-  CHECK_LENGTH(10);
-  CHECK_LENGTH(11);
-  CHECK_LENGTH(12);
+  /* only incomplete codes or sub tables which didn't fit end up here */
+  code = huff_rev16((uint16_t)bitstream, 16);
+  l    = (uint8_t)huff_code_length(table->sentinels, code, fb);
+  HUFF_STAT_SLOW(l);
 
-  for (l = 13; l <= HUFF_MAX_CODE_LENGTH; l++) { CHECK_LENGTH(l); }
+  if (l) {
+    HUFF_STAT_CODE(l);
+    *used = l;
+    return huff_table_syms(table)[(uint16_t)(table->offsets[l]
+                                             + (code >> (16 - l)))];
+  }
 
-#undef CHECK_LENGTH
   *used = 0;
   return -1;
 }
 
+/* number of symbols which can be decoded after a single refill */
+#define HUFF_SYMS_PER_REFILL  (HUFF_REFILL_BITS / HUFF_MAX_CODE_LENGTH)
+
+/*!
+ * @brief Decodes up to `count` symbols from a reader (LSB-first).
+ *
+ * The reservoir is refilled once per `HUFF_SYMS_PER_REFILL` symbols, bits
+ * which are not consumed stay in `reader` so decoding can continue with
+ * another call, e.g. with another table.
+ *
+ * @param[in]      table   Pointer to the initialized Huffman table.
+ * @param[in, out] reader  Reader initialized by `huff_reader_init()`.
+ * @param[out]     out     Decoded symbols.
+ * @param[in]      count   Max number of symbols to decode.
+ *
+ * @return Number of decoded symbols, less than `count` if input ended or an
+ *         invalid code is found, the latter also sets `HUFF_ERR_CODE`.
+ */
+HUFF_INLINE
+size_t
+huff_decode_lsb_n(const huff_table_t * __restrict table,
+                  huff_reader_t      * __restrict reader,
+                  uint16_t           * __restrict out,
+                  size_t                          count) {
+  huff_reader_t r;
+  size_t        i;
+  unsigned      j;
+  uint8_t       used;
+  uint16_t      sym;
+
+  r = *reader;
+  i = 0;
+
+  while (i < count) {
+    huff_reader_refill(&r);
+
+    if (likely(r.nbits >= HUFF_SYMS_PER_REFILL * HUFF_MAX_CODE_LENGTH
+               && count - i >= HUFF_SYMS_PER_REFILL)) {
+      for (j = 0; j < HUFF_SYMS_PER_REFILL; j++) {
+        sym = (uint16_t)huff_decode_lsb(table, r.bits, (uint8_t)r.nbits, &used);
+        if (unlikely(!used)) {
+          r.err = r.err ? r.err : HUFF_ERR_CODE;
+          goto done;
+        }
+
+        out[i++] = sym;
+        huff_reader_consume(&r, used);
+      }
+      continue;
+    }
+
+    /* tail: input is about to end or a few symbols are left */
+    sym = (uint16_t)huff_decode_lsb(table, r.bits, (uint8_t)r.nbits, &used);
+    if (!used || used > r.nbits) {
+      /* missing bits may complete the code unless the window is full */
+      if (!used && r.nbits >= HUFF_MAX_CODE_LENGTH)
+        r.err = r.err ? r.err : HUFF_ERR_CODE;
+      break;
+    }
+
+    out[i++] = sym;
+    huff_reader_consume(&r, used);
+  }
+
+done:
+  *reader = r;
+  return i;
+}
+
+#define HUFF_MAX_STREAMS      8
+
+/*!
+ * @brief Decodes independent streams in lockstep with a shared table.
+ *
+ * Each round refills every stream once and decodes `HUFF_SYMS_PER_REFILL`
+ * symbols per stream, lookups of different streams don't depend on each
+ * other so their latencies overlap, like 4-stream literals in Zstd or JPEG
+ * restart intervals. Pass `nstreams` as a constant so the loops unroll.
+ *
+ * @param[in]      table     Pointer to the initialized Huffman table.
+ * @param[in, out] readers   Readers of each stream.
+ * @param[out]     out       Output of each stream.
+ * @param[in, out] counts    Symbols to decode from each stream, on return
+ *                           number of decoded symbols of each stream.
+ * @param[in]      nstreams  Number of streams, up to `HUFF_MAX_STREAMS`.
+ *
+ * @return `true` if all requested symbols are decoded, a stream which stops
+ *         at an invalid code gets `HUFF_ERR_CODE`.
+ */
+HUFF_INLINE
+bool
+huff_decode_lsb_streams(const huff_table_t * __restrict table,
+                        huff_reader_t      * __restrict readers,
+                        uint16_t          ** __restrict out,
+                        size_t             * __restrict counts,
+                        unsigned                        nstreams) {
+  huff_reader_t r[HUFF_MAX_STREAMS];
+  size_t        i, n, f;
+  unsigned      k, j, bad, ok;
+  uint8_t       used;
+  bool          all;
+
+  if (unlikely(!nstreams || nstreams > HUFF_MAX_STREAMS))
+    return false;
+
+  n = counts[0];
+  for (k = 0; k < nstreams; k++) {
+    r[k] = readers[k];
+    if (counts[k] < n) n = counts[k];
+  }
+
+  /* lockstep rounds, a failing stream consumes nothing and keeps failing */
+  for (i = bad = 0; !bad && i + HUFF_SYMS_PER_REFILL <= n;) {
+    ok = 1;
+    for (k = 0; k < nstreams; k++) {
+      huff_reader_refill(&r[k]);
+      ok &= r[k].nbits >= HUFF_SYMS_PER_REFILL * HUFF_MAX_CODE_LENGTH;
+    }
+
+    if (unlikely(!ok))
+      break;
+
+    for (j = 0; j < HUFF_SYMS_PER_REFILL; j++) {
+      for (k = 0; k < nstreams; k++) {
+        out[k][i + j] = (uint16_t)huff_decode_lsb(table, r[k].bits,
+                                                  (uint8_t)r[k].nbits, &used);
+        bad |= !used;
+        huff_reader_consume(&r[k], used);
+      }
+    }
+
+    i += HUFF_SYMS_PER_REFILL;
+  }
+
+  all = true;
+  for (k = 0; k < nstreams; k++) {
+    f = i;
+
+    /* find where a stream failed in the last round */
+    if (unlikely(bad)) {
+      for (f = i - HUFF_SYMS_PER_REFILL; f < i; f++)
+        if (out[k][f] == (uint16_t)-1)
+          break;
+    }
+
+    if (f < i)
+      r[k].err = r[k].err ? r[k].err : HUFF_ERR_CODE;
+    else
+      f += huff_decode_lsb_n(table, &r[k], out[k] + i, counts[k] - i);
+
+    all       &= f == counts[k];
+    counts[k]  = f;
+    readers[k] = r[k];
+  }
+
+  return all;
+}
+
 #define HUFF_DECODE_LSB(table, bitstream, bit_length, used, result) do {     \
-  huff_fast_entry_t fe_;                                                      \
-  uint16_t l_, code_, bits_;                                                  \
-  uint8_t bits8_;                                                            \
+  huff_fast_entry_t fe_;                                                     \
+  uint16_t l_, code_;                                                        \
+  uint8_t fb_;                                                               \
                                                                              \
   /* align bits so LSB is always in the first position */                    \
-  bits8_ = (bitstream);                                                      \
-  fe_    = (table)->fast[bits8_];                                      \
+  fb_ = (table)->bits;                                                       \
+  fe_ = (table)->fast[(uint_fast16_t)(bitstream) & ((1U << fb_) - 1)];       \
+                                                                             \
+  if (!fe_.len && fe_.sub) {                                                 \
+    fe_ = (table)->fast[fe_.sym + ((uint_fast16_t)((bitstream) >> fb_)       \
+                                   & ((1U << fe_.sub) - 1))];                \
+    HUFF_STAT_SUB(fe_.len);                                                  \
+  }                                                                          \
                                                                              \
   if (likely(fe_.len)) {                                                     \
+    HUFF_STAT_CODE(fe_.len);                                                 \
     *(used) = fe_.len;                                                       \
     result = fe_.sym;                                                        \
   } else {                                                                   \
-    bits_ = (bitstream) >> 8;                                               \
-    code_ = fe_.rev;                                                         \
-    /* Handle remaining lengths 13+ */                                      \
-    for (l_ = 9; l_ <= HUFF_MAX_CODE_LENGTH; l_++) {                           \
-      code_ = (code_ << 1) | (bits_ & 1);                                   \
-      if (code_ < (table)->sentinels[l_]) {                                \
-        *(used) = l_;                                                       \
-        result = (table)->syms[(uint16_t)((table)->offsets[l_]+code_)];    \
-        break;                                                              \
-      }                                                                     \
-      bits_ >>= 1;                                                          \
-    }                                                                       \
-                                                                            \
-    if (l_ > HUFF_MAX_CODE_LENGTH) {                                            \
-      *(used) = 0;                                                          \
-      result = -1;                                                          \
-    }                                                                       \
-  }                                                                         \
+    /* incomplete codes only */                                              \
+    code_ = huff_rev16((uint16_t)(bitstream), 16);                           \
+    l_    = (uint16_t)huff_code_length((table)->sentinels, code_, fb_);      \
+    HUFF_STAT_SLOW(l_);                                                      \
+    if (l_) {                                                                \
+      HUFF_STAT_CODE(l_);                                                    \
+      *(used) = (uint8_t)l_;                                                 \
+      result  = huff_table_syms(table)                                       \
+                  [(uint16_t)((table)->offsets[l_] + (code_ >> (16 - l_)))]; \
+    } else {                                                                 \
+      *(used) = 0;                                                           \
+      result  = -1;                                                          \
+    }                                                                        \
+  }                                                                          \
 } while(0)
 
+/*!
+ * @brief Initializes a Huffman table with given fast table bits (LSB-first)
+ *        in caller provided memory.
+ *
+ * Codes up to `fast_bits` are resolved by the first lookup, longer codes by a
+ * second lookup in a sub table which is linked from the first level entry of
+ * their prefix. Sub tables are stored right after the first level in
+ * `table->fast`, followed by symbols. Only used entries are stored, so the
+ * table takes `huff_table_size_lengths()` bytes which can be much less than
+ * `sizeof(huff_table_t)` for small alphabets.
+ *
+ * @param[out]  mem        Memory for the table, aligned to 32 bytes.
+ * @param[in]   mem_size   Size of `mem`, e.g. by `huff_table_size()`.
+ * @param[in]   lengths    Array of bit lengths for each symbol.
+ * @param[in]   symbols    Array of symbols or `NULL` for sequential symbols.
+ * @param[in]   n          Number of symbols in the `lengths` array.
+ * @param[in]   fast_bits  Fast table bits, in [1, HUFF_FAST_TABLE_BITS], or
+ *                         `HUFF_FAST_BITS_AUTO` to pick by code lengths.
+ *                         It is increased if sub tables wouldn't fit.
+ *
+ * @return table in `mem`, `NULL` if `fast_bits` is out of range or
+ *         `mem_size` is too small.
+ */
+HUFF_INLINE
+huff_table_t*
+huff_init_lsb_mem(void           * __restrict mem,
+                  size_t                      mem_size,
+                  const uint8_t  * __restrict lengths,
+                  const uint16_t * __restrict symbols,
+                  uint16_t                    n,
+                  uint8_t                     fast_bits) {
+  huff_table_t      *table;
+  huff_fast_entry_t *fast, *subt, fe, link;
+  uint16_t           syms[HUFF_MAX_CODES];
+  uint_fast16_t      count[HUFF_MAX_CODE_LENGTH + 1];
+  uint_fast16_t      code[HUFF_MAX_CODE_LENGTH  + 1];
+  uint_fast16_t      l, k, c, end, size, cur, next, prefix, rl;
+  uint_fast32_t      nfast;
+  uint_fast8_t       maxlen, sub;
+
+  (void)symbols; /* symbols auto-generated when NULL */
+
+  if (fast_bits > HUFF_FAST_TABLE_BITS || n > HUFF_MAX_CODES
+      || mem_size < HUFF_TABLE_BYTES(huff_table_t, 0, 0))
+    return NULL;
+
+  table  = (huff_table_t *)mem;
+  maxlen = huff_canonical(table->sentinels, table->offsets, syms,
+                          count, code, lengths, n);
+
+  /* small fast tables may need more sub table entries than we have */
+  fast_bits = (uint8_t)huff_table_fit(count, fast_bits, maxlen,
+                                      mem_size < sizeof(*table), &nfast);
+
+  if (mem_size < HUFF_TABLE_BYTES(huff_table_t, nfast, n))
+    return NULL;
+
+  fast         = table->fast;
+  size         = 1U << fast_bits;
+  table->bits  = fast_bits;
+  table->nfast = (uint16_t)nfast;
+  fe.sub       = 0;
+
+  memcpy(fast + nfast, syms, n * sizeof(uint16_t));
+
+  /* codes of each length go to first 2^l entries, then doubled for next l */
+  for (l = 1; l < fast_bits && !count[l]; l++);
+  cur = 1U << l;
+  memset(fast, 0, cur * sizeof(*fast));
+
+  for (k = 0; l <= fast_bits; l++) {
+    if (cur < (1U << l)) {
+      memcpy(fast + cur, fast, cur * sizeof(*fast));
+      cur <<= 1;
+    }
+
+    fe.len = (uint8_t)l;
+    for (c = code[l], end = c + count[l]; c < end; c++, k++) {
+      fe.sym = syms[k];
+      fast[huff_rev16((uint16_t)c, (int)l)] = fe;
+    }
+  }
+
+  next     = size;
+  prefix   = (uint_fast16_t)-1;
+  subt     = NULL;
+  sub      = 0;
+  cur      = 0;
+  link.len = 0;
+
+  /* long codes in canonical order, count[] is remaining codes of each length */
+  for (l = fast_bits + 1; l <= maxlen; l++) {
+    rl     = l - fast_bits;
+    fe.len = (uint8_t)l;
+
+    for (c = code[l], end = c + count[l]; c < end; c++, k++, count[l]--) {
+      /* new prefix, complete previous sub table and start a new one */
+      if ((c >> rl) != prefix) {
+        if (subt)
+          huff_fill_double(subt, cur, 1U << sub, sizeof(*subt));
+
+        prefix = c >> rl;
+        subt   = NULL;
+
+        if (prefix < size) {
+          sub = huff_subtable_bits(count, (uint_fast8_t)l, fast_bits, maxlen);
+          if (next + (1U << sub) <= nfast) {
+            subt      = fast + next;
+            cur       = 1U << rl;
+            link.sub  = sub;
+            link.sym  = (uint16_t)next;
+            next     += 1U << sub;
+
+            memset(subt, 0, cur * sizeof(*subt));
+            fast[huff_rev16((uint16_t)prefix, fast_bits)] = link;
+          }
+        }
+      }
+
+      if (subt) {
+        huff_fill_double(subt, cur, 1U << rl, sizeof(*subt));
+        cur    = 1U << rl;
+        fe.sym = syms[k];
+        subt[huff_rev16((uint16_t)(c & (cur - 1)), (int)rl)] = fe;
+      }
+    }
+  }
+
+  if (subt)
+    huff_fill_double(subt, cur, 1U << sub, sizeof(*subt));
+
+  HUFF_ASSERT_NO_SLOW(table, lengths, n);
+  return table;
+}
+
+/*!
+ * @brief Initializes a Huffman table with given fast table bits (LSB-first).
+ *
+ * Same as `huff_init_lsb_mem()` with a full size table.
+ *
+ * @return `false` if `fast_bits` is out of range.
+ */
+HUFF_INLINE
+bool
+huff_init_lsb_bits(huff_table_t   * __restrict table,
+                   const uint8_t  * __restrict lengths,
+                   const uint16_t * __restrict symbols,
+                   uint16_t                    n,
+                   uint8_t                     fast_bits) {
+  return huff_init_lsb_mem(table, sizeof(*table), lengths, symbols, n,
+                           fast_bits) != NULL;
+}
+
+/*!
+ * @brief Same as `huff_init_lsb_bits()` but rejects invalid code lengths,
+ *        for lengths from untrusted input.
+ *
+ * A complete code has no invalid entries, so decoding with the table never
+ * needs the slow path and validation costs nothing per symbol.
+ *
+ * @param[in]  incomplete  accept incomplete codes, e.g. a single distance
+ *                         code in DEFLATE. unused codes decode as errors.
+ *
+ * @return `false` if lengths are over-subscribed, longer than
+ *         `HUFF_MAX_CODE_LENGTH`, incomplete (unless allowed) or `fast_bits`
+ *         is out of range.
+ */
+HUFF_INLINE
+bool
+huff_init_lsb_checked(huff_table_t   * __restrict table,
+                      const uint8_t  * __restrict lengths,
+                      const uint16_t * __restrict symbols,
+                      uint16_t                    n,
+                      uint8_t                     fast_bits,
+                      bool                        incomplete) {
+  int check;
+
+  check = huff_code_check(lengths, n);
+  if (check != HUFF_CODE_COMPLETE
+      && !(incomplete && check == HUFF_CODE_INCOMPLETE))
+    return false;
+
+  return huff_init_lsb_bits(table, lengths, symbols, n, fast_bits);
+}
+
+/*!
+ * @brief Decodes a symbol with sticky errors instead of sentinel values.
+ *
+ * The reader is refilled with zero padding when needed. An invalid code stops
+ * the reader with `HUFF_ERR_CODE` and returns 0, decoding past the end of the
+ * input is reported as `HUFF_ERR_INPUT`. Check `huff_reader_status()` once
+ * after a block instead of checking each symbol.
+ */
+HUFF_INLINE
+uint16_t
+huff_decode_lsb_checked(const huff_table_t * __restrict table,
+                        huff_reader_t      * __restrict reader) {
+  uint_fast16_t sym;
+  uint8_t       used;
+
+  if (reader->nbits < HUFF_MAX_CODE_LENGTH)
+    huff_reader_refill_pad(reader);
+
+  sym = huff_decode_lsb(table, reader->bits, (uint8_t)reader->nbits, &used);
+  if (unlikely(!used)) {
+    huff_reader_fail(reader, HUFF_ERR_CODE);
+    return 0;
+  }
+
+  huff_reader_consume(reader, used);
+  return (uint16_t)sym;
+}
+
 /*!
  * @brief Initializes a Huffman table for decoding LSB-first bitstreams.
  *
@@ -148,84 +521,164 @@ huff_decode_lsb(const huff_table_t * __restrict table,
  */
 HUFF_INLINE
 bool
-huff_init_lsb(huff_table_t   * restrict table,
-              const uint8_t  * restrict lengths,
-              const uint16_t * restrict symbols,
-              uint16_t                  n) {
-  uint_fast16_t l, i, prev_code = 0, prev_sym_idx = 0;
-  uint_fast16_t count[HUFF_MAX_CODE_LENGTH   + 1] = {0};
-  uint_fast16_t code[HUFF_MAX_CODE_LENGTH    + 1];
-  uint_fast16_t sym_idx[HUFF_MAX_CODE_LENGTH + 1];
-
-  (void)symbols; /* symbols auto-generated when NULL */
-
-  /**
-   * currently table->syms is fixed size array
-   *
-   * if (!table->syms) {
-   *   table->syms = calloc(n, sizeof(uint16_t));
-   *   if (!table->syms) return false;
-   * }
-   */
-
-  /* mark fast table as invalid */
-  for (i = 0; i < (1U << HUFF_FAST_TABLE_BITS); i++) {
-    table->fast[i].len = 0;
-  }
-
-  for (i = 0; i < n; i++) {
-    count[lengths[i]]++;
-  }
+huff_init_lsb(huff_table_t   * __restrict table,
+              const uint8_t  * __restrict lengths,
+              const uint16_t * __restrict symbols,
+              uint16_t                    n) {
+  return huff_init_lsb_bits(table, lengths, symbols, n, HUFF_FAST_BITS_AUTO);
+}
 
-  count[0] = code[0] = sym_idx[0] = 0;
+/*!
+ * @brief Initializes a multi-symbol Huffman table (LSB-first).
+ *
+ * Each first level entry packs all codes which fit in fast table bits one
+ * after another, up to `HUFF_MULTI_SYMS` symbols. A symbol >= `stop` ends an
+ * entry, e.g. 256 for DEFLATE lit/len codes since a length or end of block
+ * is followed by extra bits or another table. Pass `HUFF_MAX_CODES` to
+ * pack every symbol.
+ *
+ * @param[in, out]  table    Pointer to the multi-symbol table.
+ * @param[in]       lengths  Array of bit lengths for each symbol.
+ * @param[in]       symbols  Array of symbols or `NULL` for sequential symbols.
+ * @param[in]       n        Number of symbols in the `lengths` array.
+ * @param[in]       stop     First symbol which can't be followed by another.
+ */
+HUFF_INLINE
+bool
+huff_init_lsb_multi(huff_table_multi_t * __restrict table,
+                    const uint8_t      * __restrict lengths,
+                    const uint16_t     * __restrict symbols,
+                    uint16_t                        n,
+                    uint16_t                        stop) {
+  const huff_fast_entry_t *fast;
+  huff_fast_entry_t        fe;
+  huff_fast_entry_multi_t  me;
+  uint_fast16_t            i, idx, size;
+  uint_fast8_t             rb;
+
+  if (!huff_init_lsb_bits(&table->single, lengths, symbols, n,
+                          HUFF_FAST_TABLE_BITS))
+    return false;
+
+  fast        = table->single.fast;
+  size        = 1U << table->single.bits;
+  table->stop = stop;
+
+  for (i = 0; i < size; i++) {
+    me.len  = 0;
+    me.nsym = 0;
+    idx     = i;
+    rb      = table->single.bits;
+
+    /* entry of idx is valid if its code fits in remaining bits */
+    while (me.nsym < HUFF_MULTI_SYMS) {
+      fe = fast[idx];
+      if (!fe.len || fe.len > rb)
+        break;
+
+      me.sym[me.nsym++] = fe.sym;
+      me.len           += fe.len;
+
+      if (fe.sym >= stop)
+        break;
+
+      idx >>= fe.len;
+      rb   -= fe.len;
+    }
 
-  for (l = 1; l <= HUFF_MAX_CODE_LENGTH; l++) {
-    code[l]             = (prev_code   + count[l - 1]) << 1;
-    sym_idx[l]          = prev_sym_idx + count[l - 1];
-    table->sentinels[l] = code[l]      + count[l];
-    table->offsets[l]   = sym_idx[l]   - code[l];
+    for (idx = me.nsym; idx < HUFF_MULTI_SYMS; idx++)
+      me.sym[idx] = 0;
 
-    prev_code           = code[l];
-    prev_sym_idx        = sym_idx[l];
+    table->multi[i] = me;
   }
 
-  /* fast table and symbol array */
-  for (i = 0; i < n; i++) {
-    if ((l = lengths[i])) {
-      table->syms[sym_idx[l]++] = i;
+  return true;
+}
 
-      /* fill the fast table for short codes */
-      if (l <= HUFF_FAST_TABLE_BITS) {
-        uint8_t  padlen = HUFF_FAST_TABLE_BITS - l;
-        uint16_t pad;
-        uint8_t  code8, index;
+/*!
+ * @brief Decodes up to `count` symbols with a multi-symbol table (LSB-first).
+ *
+ * Same as `huff_decode_lsb_n()` but one lookup can emit several symbols.
+ * Decoding also stops right after a symbol >= `table->stop`.
+ *
+ * @return Number of decoded symbols, an invalid code sets `HUFF_ERR_CODE`.
+ */
+HUFF_INLINE
+size_t
+huff_decode_lsb_multi_n(const huff_table_multi_t * __restrict table,
+                        huff_reader_t            * __restrict reader,
+                        uint16_t                 * __restrict out,
+                        size_t                                count) {
+  huff_fast_entry_multi_t me;
+  huff_reader_t           r;
+  size_t                  i;
+  uint_fast16_t           mask;
+  unsigned                j;
+  uint8_t                 used;
+  uint16_t                sym;
+
+  r    = *reader;
+  i    = 0;
+  mask = (1U << table->single.bits) - 1;
+
+  while (i < count) {
+    huff_reader_refill(&r);
+
+    if (likely(r.nbits >= HUFF_SYMS_PER_REFILL * HUFF_MAX_CODE_LENGTH
+               && count - i >= HUFF_SYMS_PER_REFILL * HUFF_MULTI_SYMS)) {
+      for (j = 0; j < HUFF_SYMS_PER_REFILL; j++) {
+        me = table->multi[(uint_fast16_t)r.bits & mask];
+
+        if (likely(me.nsym)) {
+          memcpy(out + i, me.sym, sizeof(me.sym));
+          i   += me.nsym;
+          used = me.len;
+          sym  = me.sym[me.nsym - 1];
+        } else {
+          sym = (uint16_t)huff_decode_lsb(&table->single, r.bits,
+                                          (uint8_t)r.nbits, &used);
+          if (unlikely(!used)) {
+            r.err = r.err ? r.err : HUFF_ERR_CODE;
+            goto done;
+          }
+          out[i++] = sym;
+        }
 
-        code8 = huff_rev8((uint8_t)code[l]++, l);
+        huff_reader_consume(&r, used);
 
-        for (pad = 0; pad < (1U << padlen); pad++) {
-          index = (uint8_t)(code8 | (pad << l));
-          table->fast[index].sym = i;
-          table->fast[index].len = (uint8_t)l;
-        }
+        if (unlikely(sym >= table->stop))
+          goto done;
       }
+      continue;
     }
-  }
 
-  /* reverse bits only for slow path entries */
-  for (i = 0; i < (1U << HUFF_FAST_TABLE_BITS); i++) {
-    if (table->fast[i].len == 0) {
-      table->fast[i].rev = huff_rev8full((uint8_t)i);
+    /* tail: input is about to end or a few symbols are left */
+    sym = (uint16_t)huff_decode_lsb(&table->single, r.bits,
+                                    (uint8_t)r.nbits, &used);
+    if (!used || used > r.nbits) {
+      if (!used && r.nbits >= HUFF_MAX_CODE_LENGTH)
+        r.err = r.err ? r.err : HUFF_ERR_CODE;
+      break;
     }
+
+    out[i++] = sym;
+    huff_reader_consume(&r, used);
+
+    if (sym >= table->stop)
+      break;
   }
-  return true;
+
+done:
+  *reader = r;
+  return i;
 }
 
 HUFF_INLINE
 bool
 huff_init_fast_lsb(huff_fast_entry_t         fast[HUFF_FAST_TABLE_SIZE],
-                   const uint8_t  * restrict lengths,
-                   const uint16_t * restrict symbols,
-                   uint16_t                  n) {
+                   const uint8_t  * __restrict lengths,
+                   const uint16_t * __restrict symbols,
+                   uint16_t                    n) {
   uint_fast16_t l, i, prev_code = 0;
   uint_fast16_t count[HUFF_FAST_TABLE_BITS + 1] = {0};
   uint_fast16_t code[HUFF_FAST_TABLE_BITS  + 1];
@@ -235,6 +688,7 @@ huff_init_fast_lsb(huff_fast_entry_t         fast[HUFF_FAST_TABLE_SIZE],
   /* mark fast table as invalid */
   for (i = 0; i < (1U << HUFF_FAST_TABLE_BITS); i++) {
     fast[i].len = 0;
+    fast[i].sub = 0;
   }
 
   /* only count lengths <= HUFF_FAST_TABLE_BITS */
@@ -255,14 +709,14 @@ huff_init_fast_lsb(huff_fast_entry_t         fast[HUFF_FAST_TABLE_SIZE],
   /* fill fast table */
   for (i = 0; i < n; i++) {
     if ((l = lengths[i]) && l <= HUFF_FAST_TABLE_BITS) {
-      uint8_t  code8 = huff_rev8((uint8_t)code[l]++, l);
-      uint8_t  padlen = HUFF_FAST_TABLE_BITS - l;
+      uint16_t code16 = huff_rev16((uint16_t)code[l]++, (int)l);
+      uint16_t padlen = HUFF_FAST_TABLE_BITS - l;
       uint16_t pad;
 
       for (pad = 0; pad < (1U << padlen); pad++) {
-        uint8_t index = code8 | (pad << l);
-        fast[index].sym = i;
-        fast[index].len = l;
+        uint16_t index = (uint16_t)(code16 | (pad << l));
+        fast[index].sym = (uint16_t)i;
+        fast[index].len = (uint8_t)l;
       }
     }
   }
@@ -270,79 +724,202 @@ huff_init_fast_lsb(huff_fast_entry_t         fast[HUFF_FAST_TABLE_SIZE],
   return true;
 }
 
+/*!
+ * @brief Initializes an extended Huffman table with given fast table bits.
+ *
+ * Same layout as `huff_init_lsb_mem()`, each entry also carries extra bits
+ * info of its symbol. Symbols below `offset` have no extra bits, `extras` is
+ * indexed by `symbol - offset`. `mem_size` can be `huff_table_ext_size()` or
+ * `huff_table_ext_size_lengths()`.
+ *
+ * @return table in `mem`, `NULL` if `fast_bits` is out of range or
+ *         `mem_size` is too small.
+ */
 HUFF_INLINE
-bool
-huff_init_lsb_ext(huff_table_ext_t   * __restrict table,
-                  const uint8_t      * __restrict lengths,
-                  const uint16_t     * __restrict symbols,
-                  const huff_ext_t   * __restrict extras,
-                  uint16_t                      n) {
-  uint_fast16_t l, i, prev_code, prev_sym_idx;
-  uint_fast16_t count[HUFF_MAX_CODE_LENGTH   + 1] = {0};
-  uint_fast16_t code[HUFF_MAX_CODE_LENGTH    + 1];
-  uint_fast16_t sym_idx[HUFF_MAX_CODE_LENGTH + 1];
+huff_table_ext_t*
+huff_init_lsb_extof_mem(void               * __restrict mem,
+                         size_t                          mem_size,
+                         const uint8_t      * __restrict lengths,
+                         const uint16_t     * __restrict symbols,
+                         const huff_ext_t   * __restrict extras,
+                         int                             offset,
+                         uint16_t                        n,
+                         uint8_t                         fast_bits) {
+  huff_table_ext_t      *table;
+  huff_fast_entry_ext_t *fast, *subt, fe, link;
+  huff_ext_t             ext;
+  uint16_t               syms[HUFF_MAX_CODES];
+  uint_fast16_t          count[HUFF_MAX_CODE_LENGTH + 1];
+  uint_fast16_t          code[HUFF_MAX_CODE_LENGTH  + 1];
+  uint_fast16_t          l, k, c, end, size, cur, next, prefix, rl;
+  uint_fast32_t          nfast;
+  uint_fast8_t           maxlen, sub;
 
   (void)symbols; /* symbols auto-generated when NULL */
 
-  prev_code    = 0;
-  prev_sym_idx = 0;
-
-  /* mark fast table as invalid */
-  for (i = 0; i < (1U << HUFF_FAST_TABLE_BITS); i++)
-    table->fast[i].len = 0;
+  if (fast_bits > HUFF_FAST_TABLE_BITS || n > HUFF_MAX_CODES
+      || mem_size < HUFF_TABLE_BYTES(huff_table_ext_t, 0, 0))
+    return NULL;
 
-  for (i = 0; i < n; i++)
-    count[lengths[i]]++;
+  table  = (huff_table_ext_t *)mem;
+  maxlen = huff_canonical(table->sentinels, table->offsets, syms,
+                          count, code, lengths, n);
 
-  count[0] = code[0] = sym_idx[0] = 0;
+  /* small fast tables may need more sub table entries than we have */
+  fast_bits = (uint8_t)huff_table_fit(count, fast_bits, maxlen,
+                                      mem_size < sizeof(*table), &nfast);
 
-  for (l = 1; l <= HUFF_MAX_CODE_LENGTH; l++) {
-    code[l]             = (prev_code   + count[l - 1]) << 1;
-    sym_idx[l]          = prev_sym_idx + count[l - 1];
-    table->sentinels[l] = code[l]      + count[l];
-    table->offsets[l]   = sym_idx[l]   - code[l];
-
-    prev_code    = code[l];
-    prev_sym_idx = sym_idx[l];
-  }
+  if (mem_size < HUFF_TABLE_BYTES(huff_table_ext_t, nfast, n))
+    return NULL;
 
+  fast          = table->fast;
+  size          = 1U << fast_bits;
+  table->bits   = fast_bits;
+  table->nfast  = (uint16_t)nfast;
   table->extras = extras;
-  table->offset = 0;
-
-  /* fast table and symbol array */
-  for (i = 0; i < n; i++) {
-    if ((l = lengths[i])) {
-      table->syms[sym_idx[l]++] = i;
+  table->offset = offset;
 
-      if (l <= HUFF_FAST_TABLE_BITS) {
-        huff_ext_t ext;
-        uint8_t    padlen, code8, index;
-        uint16_t   pad;
+  memcpy(fast + nfast, syms, n * sizeof(uint16_t));
+
+  memset(&fe,   0, sizeof(fe));
+  memset(&link, 0, sizeof(link));
+
+#define HUFF_EXT_ENTRY(l)                                                     \
+  fe.len = (uint8_t)(l);                                                      \
+  fe.sym = syms[k];                                                           \
+  if ((int)fe.sym >= offset) {                                                \
+    ext      = extras[fe.sym - offset];                                       \
+    fe.base  = (uint16_t)ext.base;                                            \
+    fe.bits  = (uint8_t)ext.bits;                                             \
+  } else {                                                                    \
+    fe.base  = 0;                                                             \
+    fe.bits  = 0;                                                             \
+  }                                                                           \
+  fe.total = (uint8_t)((l) + fe.bits);
 
-        code8  = huff_rev8((uint8_t)code[l]++, l);
-        padlen = HUFF_FAST_TABLE_BITS - l;
+  /* codes of each length go to first 2^l entries, then doubled for next l */
+  for (l = 1; l < fast_bits && !count[l]; l++);
+  cur = 1U << l;
+  memset(fast, 0, cur * sizeof(*fast));
 
-        for (pad = 0; pad < (1U << padlen); pad++) {
-          index = (uint8_t)(code8 | (pad << l));
-          ext   = extras[i];
+  for (k = 0; l <= fast_bits; l++) {
+    if (cur < (1U << l)) {
+      memcpy(fast + cur, fast, cur * sizeof(*fast));
+      cur <<= 1;
+    }
 
-          table->fast[index].sym   = i;
-          table->fast[index].len   = (uint8_t)l;
+    for (c = code[l], end = c + count[l]; c < end; c++, k++) {
+      HUFF_EXT_ENTRY(l)
+      fast[huff_rev16((uint16_t)c, (int)l)] = fe;
+    }
+  }
 
-          table->fast[index].value = (uint32_t)ext.base;
-          table->fast[index].total = l + (uint8_t)ext.bits;
-          table->fast[index].mask  = (1U<<ext.bits)-1;
+  next   = size;
+  prefix = (uint_fast16_t)-1;
+  subt   = NULL;
+  sub    = 0;
+  cur    = 0;
+
+  /* long codes in canonical order, count[] is remaining codes of each length */
+  for (l = fast_bits + 1; l <= maxlen; l++) {
+    rl = l - fast_bits;
+
+    for (c = code[l], end = c + count[l]; c < end; c++, k++, count[l]--) {
+      /* new prefix, complete previous sub table and start a new one */
+      if ((c >> rl) != prefix) {
+        if (subt)
+          huff_fill_double(subt, cur, 1U << sub, sizeof(*subt));
+
+        prefix = c >> rl;
+        subt   = NULL;
+
+        if (prefix < size) {
+          sub = huff_subtable_bits(count, (uint_fast8_t)l, fast_bits, maxlen);
+          if (next + (1U << sub) <= nfast) {
+            subt      = fast + next;
+            cur       = 1U << rl;
+            link.sub  = sub;
+            link.sym  = (uint16_t)next;
+            next     += 1U << sub;
+
+            memset(subt, 0, cur * sizeof(*subt));
+            fast[huff_rev16((uint16_t)prefix, fast_bits)] = link;
+          }
         }
       }
+
+      if (subt) {
+        huff_fill_double(subt, cur, 1U << rl, sizeof(*subt));
+        cur = 1U << rl;
+        HUFF_EXT_ENTRY(l)
+        subt[huff_rev16((uint16_t)(c & (cur - 1)), (int)rl)] = fe;
+      }
     }
   }
 
-  /* reverse bits only for slow path entries */
-  for (i = 0; i < (1U << HUFF_FAST_TABLE_BITS); i++)
-    if (!table->fast[i].len)
-      table->fast[i].rev = huff_rev8full((uint8_t)i);
+#undef HUFF_EXT_ENTRY
 
-  return true;
+  if (subt)
+    huff_fill_double(subt, cur, 1U << sub, sizeof(*subt));
+
+  HUFF_ASSERT_NO_SLOW(table, lengths, n);
+  return table;
+}
+
+/*!
+ * @brief Initializes an extended Huffman table with given fast table bits.
+ *
+ * Same as `huff_init_lsb_extof_mem()` with a full size table.
+ *
+ * @return `false` if `fast_bits` is out of range.
+ */
+HUFF_INLINE
+bool
+huff_init_lsb_extof_bits(huff_table_ext_t   * __restrict table,
+                         const uint8_t      * __restrict lengths,
+                         const uint16_t     * __restrict symbols,
+                         const huff_ext_t   * __restrict extras,
+                         int                             offset,
+                         uint16_t                        n,
+                         uint8_t                         fast_bits) {
+  return huff_init_lsb_extof_mem(table, sizeof(*table), lengths, symbols,
+                                 extras, offset, n, fast_bits) != NULL;
+}
+
+/*!
+ * @brief Same as `huff_init_lsb_extof_bits()` but rejects invalid code
+ *        lengths, see `huff_init_lsb_checked()`.
+ */
+HUFF_INLINE
+bool
+huff_init_lsb_extof_checked(huff_table_ext_t   * __restrict table,
+                            const uint8_t      * __restrict lengths,
+                            const uint16_t     * __restrict symbols,
+                            const huff_ext_t   * __restrict extras,
+                            int                             offset,
+                            uint16_t                        n,
+                            uint8_t                         fast_bits,
+                            bool                            incomplete) {
+  int check;
+
+  check = huff_code_check(lengths, n);
+  if (check != HUFF_CODE_COMPLETE
+      && !(incomplete && check == HUFF_CODE_INCOMPLETE))
+    return false;
+
+  return huff_init_lsb_extof_bits(table, lengths, symbols, extras, offset, n,
+                                  fast_bits);
+}
+
+HUFF_INLINE
+bool
+huff_init_lsb_ext(huff_table_ext_t   * __restrict table,
+                  const uint8_t      * __restrict lengths,
+                  const uint16_t     * __restrict symbols,
+                  const huff_ext_t   * __restrict extras,
+                  uint16_t                      n) {
+  return huff_init_lsb_extof_bits(table, lengths, symbols, extras, 0, n,
+                                  HUFF_FAST_BITS_AUTO);
 }
 
 HUFF_INLINE
@@ -353,77 +930,8 @@ huff_init_lsb_extof(huff_table_ext_t   * __restrict table,
                     const huff_ext_t   * __restrict extras,
                     int                           offset,
                     uint16_t                      n) {
-  uint_fast16_t l, i, prev_code, prev_sym_idx;
-  uint_fast16_t count[HUFF_MAX_CODE_LENGTH   + 1] = {0};
-  uint_fast16_t code[HUFF_MAX_CODE_LENGTH    + 1];
-  uint_fast16_t sym_idx[HUFF_MAX_CODE_LENGTH + 1];
-
-  (void)symbols; /* symbols auto-generated when NULL */
-
-  prev_code    = 0;
-  prev_sym_idx = 0;
-
-  /* mark fast table as invalid */
-  for (i = 0; i < (1U << HUFF_FAST_TABLE_BITS); i++)
-    table->fast[i].len = 0;
-
-  for (i = 0; i < n; i++)
-    count[lengths[i]]++;
-
-  count[0] = code[0] = sym_idx[0] = 0;
-
-  for (l = 1; l <= HUFF_MAX_CODE_LENGTH; l++) {
-    code[l]             = (prev_code   + count[l - 1]) << 1;
-    sym_idx[l]          = prev_sym_idx + count[l - 1];
-    table->sentinels[l] = code[l]      + count[l];
-    table->offsets[l]   = sym_idx[l]   - code[l];
-
-    prev_code    = code[l];
-    prev_sym_idx = sym_idx[l];
-  }
-
-  table->extras = extras;
-  table->offset = offset;
-
-  /* fast table and symbol array */
-  for (i = 0; i < n; i++) {
-    if ((l = lengths[i])) {
-      table->syms[sym_idx[l]++] = i;
-
-      if (l <= HUFF_FAST_TABLE_BITS) {
-        huff_ext_t ext;
-        uint8_t    padlen, code8, index;
-        uint16_t   pad;
-
-        code8  = huff_rev8((uint8_t)code[l]++, l);
-        padlen = HUFF_FAST_TABLE_BITS - l;
-
-        for (pad = 0; pad < (1U << padlen); pad++) {
-          index                  = (uint8_t)(code8 | (pad << l));
-          table->fast[index].sym = i;
-          table->fast[index].len = (uint8_t)l;
-          
-          if ((int)i >= offset) {
-            ext                      = extras[i - offset];
-            table->fast[index].value = (uint32_t)ext.base;
-            table->fast[index].total = l + (uint8_t)ext.bits;
-            table->fast[index].mask  = (1U<<ext.bits)-1;
-          } else {
-            table->fast[index].value = 0;
-            table->fast[index].mask  = 0;
-            table->fast[index].total = l;
-          }
-        }
-      }
-    }
-  }
-
-  /* reverse bits only for slow path entries */
-  for (i = 0; i < (1U << HUFF_FAST_TABLE_BITS); i++)
-    if (!table->fast[i].len)
-      table->fast[i].rev = huff_rev8full((uint8_t)i);
-
-  return true;
+  return huff_init_lsb_extof_bits(table, lengths, symbols, extras, offset, n,
+                                  HUFF_FAST_BITS_AUTO);
 }
 
 HUFF_INLINE
@@ -433,30 +941,45 @@ huff_decode_lsb_ext(const huff_table_ext_t * __restrict table,
                     uint8_t                * __restrict used) {
   huff_fast_entry_ext_t fe;
   huff_ext_t            ext;
-  uint16_t              l, code, bits, sym;
-  uint8_t               bits8;
+  uint16_t              l, code, sym;
+  uint8_t               fb;
 
   /* align bits so LSB is always in the first position */
-  bits8 = (uint8_t)bitstream;
-  fe    = table->fast[bits8];
+  fb = table->bits;
+  fe = table->fast[(uint_fast16_t)bitstream & ((1U << fb) - 1)];
+
+  /* sub table, indexed by the next fe.sub bits */
+  if (unlikely(!fe.len && fe.sub)) {
+    fe = table->fast[fe.sym
+                     + ((uint_fast16_t)(bitstream >> fb) & ((1U << fe.sub) - 1))];
+    HUFF_STAT_SUB(fe.len);
+  }
 
   if (likely(fe.len)) {
+    HUFF_STAT_CODE(fe.len);
     *used = fe.total;
-    return fe.value + (fe.mask & (unsigned)(bitstream >> fe.len));
+    return fe.base + ((unsigned)(bitstream >> fe.len) & ((1U << fe.bits) - 1));
   }
 
-  bits = (uint16_t)(bitstream >> 8);
-  code = fe.rev; /* huff_rev8full(bits8); */
+  /* only incomplete codes or sub tables which didn't fit end up here */
+  code = huff_rev16((uint16_t)bitstream, 16);
+  l    = (uint16_t)huff_code_length(table->sentinels, code, fb);
+  HUFF_STAT_SLOW(l);
 
-  for (l = 9; l <= HUFF_MAX_CODE_LENGTH; l++) {
-    code = (code << 1) | (bits & 1);
-    if (code < table->sentinels[l]) {
-      sym    = table->syms[(uint16_t)(table->offsets[l] + code)];
-      ext    = table->extras[sym];
-      *used  = l + (uint8_t)ext.bits;
-      return (unsigned)(ext.base + (ext.mask & (unsigned)(bitstream >> l)));
+  if (l) {
+    HUFF_STAT_CODE(l);
+    code   = code >> (16 - l);
+    sym    = huff_table_syms(table)[(uint16_t)(table->offsets[l] + code)];
+
+    /* same as fast entries: symbols below offset have no extras */
+    if (unlikely((int)sym < table->offset)) {
+      *used = (uint8_t)l;
+      return 0;
     }
-    bits >>= 1;
+
+    ext    = table->extras[sym - table->offset];
+    *used  = l + (uint8_t)ext.bits;
+    return (unsigned)(ext.base + (ext.mask & (unsigned)(bitstream >> l)));
   }
 
   *used = 0;
@@ -472,44 +995,112 @@ huff_decode_lsb_extof(const huff_table_ext_t * __restrict table,
                       int                                 offset) {
   huff_fast_entry_ext_t fe;
   huff_ext_t            ext;
-  uint16_t              l, code, bits, sym;
-  uint8_t               bits8;
+  uint16_t              l, code, sym;
+  uint8_t               fb;
 
   /* align bits so LSB is always in the first position */
-  bits8 = (uint8_t)bitstream;
-  fe    = table->fast[bits8];
+  fb = table->bits;
+  fe = table->fast[(uint_fast16_t)bitstream & ((1U << fb) - 1)];
+
+  /* sub table, indexed by the next fe.sub bits */
+  if (unlikely(!fe.len && fe.sub)) {
+    fe = table->fast[fe.sym
+                     + ((uint_fast16_t)(bitstream >> fb) & ((1U << fe.sub) - 1))];
+    HUFF_STAT_SUB(fe.len);
+  }
 
   if (likely(fe.len)) {
+    HUFF_STAT_CODE(fe.len);
     *used  = fe.total;
-    *value = fe.value + (fe.mask & (unsigned)(bitstream >> fe.len));
+    *value = fe.base + ((unsigned)(bitstream >> fe.len) & ((1U << fe.bits) - 1));
     return fe.sym;
   }
 
-  bits = (uint16_t)(bitstream >> 8);
-  code = fe.rev; /* huff_rev8full(bits8); */
-
-  /* slow path */
-  for (l = 9; l <= HUFF_MAX_CODE_LENGTH; l++) {
-    code = (code << 1) | (bits & 1);
-    if (code < table->sentinels[l]) {
-      sym = table->syms[(uint16_t)(table->offsets[l] + code)];
-      if (likely(sym >= offset)) {
-        ext    = table->extras[sym - offset];
-        *value = (unsigned)(ext.base + (ext.mask & (unsigned)(bitstream >> l)));
-        *used  = l + (uint8_t)ext.bits;
-      } else {
-        *used  = (uint8_t)l;
-        *value = 0;
-      }
-      return sym;
+  /* slow path, only incomplete codes or sub tables which didn't fit */
+  code = huff_rev16((uint16_t)bitstream, 16);
+  l    = (uint16_t)huff_code_length(table->sentinels, code, fb);
+  HUFF_STAT_SLOW(l);
+
+  if (l) {
+    HUFF_STAT_CODE(l);
+    code = code >> (16 - l);
+    sym  = huff_table_syms(table)[(uint16_t)(table->offsets[l] + code)];
+    if (likely(sym >= offset)) {
+      ext    = table->extras[sym - offset];
+      *value = (unsigned)(ext.base + (ext.mask & (unsigned)(bitstream >> l)));
+      *used  = l + (uint8_t)ext.bits;
+    } else {
+      *used  = (uint8_t)l;
+      *value = 0;
     }
-    bits >>= 1;
+    return sym;
   }
 
   *used = 0;
   return -1;
 }
 
+/* worst case bits of a deflate match: 15 + 5 + 15 + 13 */
+#define HUFF_MATCH_BITS       48
+
+/*!
+ * @brief decode a lit/len symbol and, if it is a match, its distance with a
+ *        single refill. worst case is `HUFF_MATCH_BITS` bits for deflate
+ *        which fits in one refill. the reader is only refilled if it has less
+ *        than that, a 128-bit reservoir covers two matches per refill.
+ *
+ * @param litlen     lit/len table, symbols >= litlen->offset are lengths
+ * @param dist       distance table
+ * @param reader     bit reader, only advanced on success, an invalid code
+ *                   sets `HUFF_ERR_CODE` if there were enough bits
+ * @param lit_or_len literal symbol or length value of the match
+ * @param distance   distance value, only set for matches
+ * @return lit/len symbol, -1 on invalid code or not enough bits
+ */
+HUFF_INLINE
+uint_fast16_t
+huff_decode_match_lsb(const huff_table_ext_t * __restrict litlen,
+                      const huff_table_ext_t * __restrict dist,
+                      huff_reader_t          * __restrict reader,
+                      unsigned               * __restrict lit_or_len,
+                      unsigned               * __restrict distance) {
+  huff_reader_t r;
+  uint_fast16_t sym;
+  unsigned      value;
+  uint8_t       used;
+
+  r = *reader;
+  if (r.nbits < HUFF_MATCH_BITS)
+    huff_reader_refill(&r);
+
+  sym = huff_decode_lsb_extof(litlen, r.bits, &used, &value, litlen->offset);
+  if (unlikely(!used || used > r.nbits))
+    goto fail;
+
+  huff_reader_consume(&r, used);
+
+  if ((int)sym < litlen->offset) {
+    *lit_or_len = (unsigned)sym;
+    *reader     = r;
+    return sym;
+  }
+
+  *lit_or_len = value;
+  *distance   = huff_decode_lsb_ext(dist, r.bits, &used);
+  if (unlikely(!used || used > r.nbits))
+    goto fail;
+
+  huff_reader_consume(&r, used);
+  *reader = r;
+  return sym;
+
+fail:
+  /* missing bits may complete the code unless the window is full */
+  if (!used && r.nbits >= HUFF_MAX_CODE_LENGTH)
+    reader->err = reader->err ? reader->err : HUFF_ERR_CODE;
+  return -1;
+}
+
 #ifdef __cplusplus
 }
 #endif
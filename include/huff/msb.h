@@ -20,20 +20,17 @@
 extern "C" {
 #endif
 
-/**
- * TODO:
- */
+#include <string.h>
 
 /**
  * @brief Decodes a single symbol from a Huffman-encoded bitstream (MSB-first).
  *
  * This function decodes a symbol using a pre-initialized Huffman table. The
- * bitstream is expected to be in MSB-first order, where the most significant
- * bits are processed first. If the bitstream is in LSB-first order, it should
- * be reversed before calling this function. You can use `huff_rev_bits()` to
- * reverse the bitstream if needed.
+ * bitstream is expected to be in MSB-first order and left-aligned, the next
+ * bit to decode is the most significant bit of `bitstream`. No bit reversal
+ * is needed; the fast table is indexed by the top bits of the window.
  *
- * @param[in]     table       Pointer to the initialized Huffman table.
+ * @param[in]     table       Pointer to the table initialized by `huff_init_msb()`.
  * @param[in]     bitstream   The bitstream to decode, in MSB-first order.
  * @param[in]     bit_length  The number of valid bits in the bitstream.
  * @param[out]    used_bits   Pointer to store the number of bits used to decode.
@@ -43,12 +40,264 @@ extern "C" {
  * @note The caller is responsible for ensuring the bitstream contains
  *       enough valid bits for decoding a symbol.
  */
-//HUFF_EXPORT
-//uint_fast16_t
-//huff_decode_msb(const huff_table_t * __restrict table,
-//                bitstream_t                     bitstream,
-//                uint8_t                         bit_length,
-//                uint8_t            * __restrict used_bits);
+HUFF_INLINE
+uint_fast16_t
+huff_decode_msb(const huff_table_t * __restrict table,
+                bitstream_t                     bitstream,
+                uint8_t                         bit_length,
+                uint8_t            * __restrict used_bits) {
+  huff_fast_entry_t fe;
+  uint16_t          code;
+  uint8_t           l, fb;
+
+  (void)bit_length;
+
+  fb = table->bits;
+  fe = table->fast[(uint_fast16_t)(bitstream >> (HUFF_BITSTREAM_BITS - fb))];
+
+  if (likely(fe.len)) {
+    *used_bits = fe.len;
+    return fe.sym;
+  }
+
+  /* sub table, indexed by the next fe.sub bits */
+  if (likely(fe.sub)) {
+    fe = table->fast[fe.sym + (uint_fast16_t)((bitstream << fb)
+                                              >> (HUFF_BITSTREAM_BITS - fe.sub))];
+    if (likely(fe.len)) {
+      *used_bits = fe.len;
+      return fe.sym;
+    }
+  }
+
+  /* only incomplete codes end up here, maxcode[l] is one past the last code */
+  code = (uint16_t)(bitstream >> (HUFF_BITSTREAM_BITS - 16));
+  l    = (uint8_t)huff_code_length(table->maxcode, code, fb);
+
+  if (l) {
+    *used_bits = l;
+    return huff_table_syms(table)[(uint16_t)(table->mincode[l]
+                                             + (code >> (16 - l)))];
+  }
+
+  *used_bits = 0;
+  return -1;
+}
+
+/*!
+ * @brief Initializes a Huffman table with given fast table bits (MSB-first)
+ *        in caller provided memory.
+ *
+ * Same layout as `huff_init_lsb_mem()` but entries are indexed by codes as
+ * they are, without bit reversal.
+ *
+ * @param[out]  mem        Memory for the table, aligned to 32 bytes.
+ * @param[in]   mem_size   Size of `mem`, e.g. by `huff_table_size()`.
+ * @param[in]   lengths    Array of bit lengths for each symbol.
+ * @param[in]   symbols    Array of symbols or `NULL` for sequential symbols.
+ * @param[in]   n          Number of symbols in the `lengths` array.
+ * @param[in]   fast_bits  Fast table bits, in [1, HUFF_FAST_TABLE_BITS], or
+ *                         `HUFF_FAST_BITS_AUTO` to pick by code lengths.
+ *                         It is increased if sub tables wouldn't fit.
+ *
+ * @return table in `mem`, `NULL` if `fast_bits` is out of range or
+ *         `mem_size` is too small.
+ */
+HUFF_INLINE
+huff_table_t*
+huff_init_msb_mem(void           * __restrict mem,
+                  size_t                      mem_size,
+                  const uint8_t  * __restrict lengths,
+                  const uint16_t * __restrict symbols,
+                  uint16_t                    n,
+                  uint8_t                     fast_bits) {
+  huff_table_t      *table;
+  huff_fast_entry_t *fast, *subt, fe, link;
+  uint16_t           syms[HUFF_MAX_CODES];
+  uint_fast16_t      count[HUFF_MAX_CODE_LENGTH + 1];
+  uint_fast16_t      code[HUFF_MAX_CODE_LENGTH  + 1];
+  uint_fast16_t      l, k, c, end, idx, size, next, prefix, rl, filled, sfilled;
+  uint_fast32_t      nfast;
+  uint_fast8_t       maxlen, sub;
+  uint32_t           v;
+
+  (void)symbols; /* symbols auto-generated when NULL */
+
+  if (fast_bits > HUFF_FAST_TABLE_BITS || n > HUFF_MAX_CODES
+      || mem_size < HUFF_TABLE_BYTES(huff_table_t, 0, 0))
+    return NULL;
+
+  table  = (huff_table_t *)mem;
+  maxlen = huff_canonical(table->maxcode, table->mincode, syms,
+                          count, code, lengths, n);
+
+  /* small fast tables may need more sub table entries than we have */
+  fast_bits = (uint8_t)huff_table_fit(count, fast_bits, maxlen,
+                                      mem_size < sizeof(*table), &nfast);
+
+  if (mem_size < HUFF_TABLE_BYTES(huff_table_t, nfast, n))
+    return NULL;
+
+  table->nfast = (uint16_t)nfast;
+  memcpy(table->fast + nfast, syms, n * sizeof(uint16_t));
+
+  fast        = table->fast;
+  size        = 1U << fast_bits;
+  table->bits = fast_bits;
+
+  next     = size;
+  prefix   = (uint_fast16_t)-1;
+  subt     = NULL;
+  sub      = 0;
+  filled   = sfilled = 0;
+  fe.sub   = 0;
+  link.len = 0;
+
+  /**
+   * canonical codes are contiguous runs in ascending order, so each entry is
+   * stored once; only gaps (unused or slow path entries) are zeroed.
+   */
+  for (l = 1, k = 0; l <= fast_bits && l <= maxlen; l++) {
+    fe.len = (uint8_t)l;
+
+    for (c = code[l], end = c + count[l]; c < end; c++, k++) {
+      /* over-subscribed */
+      if (unlikely(c >> l))
+        continue;
+
+      fe.sym = syms[k];
+      memcpy(&v, &fe, sizeof(v));
+
+      idx = c << (fast_bits - l);
+      if (unlikely(idx > filled))
+        memset(fast + filled, 0, (idx - filled) * sizeof(*fast));
+
+      huff_fill32(fast + idx, v, 1U << (fast_bits - l));
+      filled = idx + (1U << (fast_bits - l));
+    }
+  }
+
+  /* long codes, count[] is remaining codes of each length */
+  for (; l <= maxlen; l++) {
+    fe.len = (uint8_t)l;
+    rl     = l - fast_bits;
+
+    for (c = code[l], end = c + count[l]; c < end; c++, k++, count[l]--) {
+      /* over-subscribed */
+      if (unlikely(c >> l))
+        continue;
+
+      fe.sym = syms[k];
+      memcpy(&v, &fe, sizeof(v));
+
+      /* new prefix, complete previous sub table and start a new one */
+      if ((c >> rl) != prefix) {
+        if (subt)
+          memset(subt + sfilled, 0, ((1U << sub) - sfilled) * sizeof(*subt));
+
+        prefix = c >> rl;
+        subt   = NULL;
+        sub    = huff_subtable_bits(count, (uint_fast8_t)l, fast_bits, maxlen);
+
+        if (next + (1U << sub) <= nfast) {
+          if (unlikely(prefix > filled))
+            memset(fast + filled, 0, (prefix - filled) * sizeof(*fast));
+
+          link.sub     = sub;
+          link.sym     = (uint16_t)next;
+          fast[prefix] = link;
+          filled       = prefix + 1;
+          subt         = fast + next;
+          sfilled      = 0;
+          next        += 1U << sub;
+        }
+      }
+
+      if (subt) {
+        idx = (c & ((1U << rl) - 1)) << (sub - rl);
+        if (unlikely(idx > sfilled))
+          memset(subt + sfilled, 0, (idx - sfilled) * sizeof(*subt));
+
+        huff_fill32(subt + idx, v, 1U << (sub - rl));
+        sfilled = idx + (1U << (sub - rl));
+      }
+    }
+  }
+
+  if (subt)
+    memset(subt + sfilled, 0, ((1U << sub) - sfilled) * sizeof(*subt));
+
+  if (filled < size)
+    memset(fast + filled, 0, (size - filled) * sizeof(*fast));
+
+  HUFF_ASSERT_NO_SLOW(table, lengths, n);
+  return table;
+}
+
+/*!
+ * @brief Initializes a Huffman table with given fast table bits (MSB-first).
+ *
+ * Same as `huff_init_msb_mem()` with a full size table.
+ *
+ * @return `false` if `fast_bits` is out of range.
+ */
+HUFF_INLINE
+bool
+huff_init_msb_bits(huff_table_t   * __restrict table,
+                   const uint8_t  * __restrict lengths,
+                   const uint16_t * __restrict symbols,
+                   uint16_t                    n,
+                   uint8_t                     fast_bits) {
+  return huff_init_msb_mem(table, sizeof(*table), lengths, symbols, n,
+                           fast_bits) != NULL;
+}
+
+/*!
+ * @brief Same as `huff_init_msb_bits()` but rejects invalid code lengths,
+ *        see `huff_init_lsb_checked()`.
+ */
+HUFF_INLINE
+bool
+huff_init_msb_checked(huff_table_t   * __restrict table,
+                      const uint8_t  * __restrict lengths,
+                      const uint16_t * __restrict symbols,
+                      uint16_t                    n,
+                      uint8_t                     fast_bits,
+                      bool                        incomplete) {
+  int check;
+
+  check = huff_code_check(lengths, n);
+  if (check != HUFF_CODE_COMPLETE
+      && !(incomplete && check == HUFF_CODE_INCOMPLETE))
+    return false;
+
+  return huff_init_msb_bits(table, lengths, symbols, n, fast_bits);
+}
+
+/*!
+ * @brief Initializes a Huffman table for decoding MSB-first bitstreams.
+ *
+ * This function initializes a Huffman table using the provided symbol lengths
+ * and symbols, e.g. JPEG or MPEG codes. Use `huff_decode_msb()` to decode.
+ *
+ * @param[in, out]  table    Pointer to the Huffman table to be initialized.
+ * @param[in]       lengths  Array of bit lengths for each symbol. The length of
+ *                           each symbol must not exceed `HUFF_MAX_CODE_LENGTH`.
+ * @param[in]       symbols  Array of symbols corresponding to the provided lengths.
+ *                           Pass `NULL` for sequential symbols.
+ * @param[in]       n        Number of symbols in the `lengths` (and `symbols`, if provided) array.
+ *
+ * @note This function supports MSB-first bitstreams. For LSB-first bitstreams,
+ *       use `huff_init_lsb()`.
+ */
+HUFF_INLINE
+bool
+huff_init_msb(huff_table_t   * __restrict table,
+              const uint8_t  * __restrict lengths,
+              const uint16_t * __restrict symbols,
+              uint16_t                    n) {
+  return huff_init_msb_bits(table, lengths, symbols, n, HUFF_FAST_BITS_AUTO);
+}
 
 #ifdef __cplusplus
 }
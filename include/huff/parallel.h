@@ -0,0 +1,575 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * parallel decoding of independent segments, e.g. JPEG restart intervals,
+ * gzip members or Zstd 4-stream literals. jobs are split between workers of a
+ * pool, a worker which runs out of jobs steals half of the jobs left to
+ * another worker. tables are only read, the same table can be shared by any
+ * number of jobs.
+ *
+ * not included by huff.h, needs pthreads (or windows threads).
+ */
+
+#ifndef huff_parallel_h
+#define huff_parallel_h
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "huff.h"
+#include "thread.h"
+
+typedef struct huff_job_t huff_job_t;
+
+/* custom decoder of a job, e.g. for MSB-first codes */
+typedef void (*huff_job_fn)(huff_job_t *job);
+
+struct huff_job_t {
+  const huff_table_t *table;   /* shared, read only                         */
+  const uint8_t      *in;      /* segment                                   */
+  size_t              in_len;
+  uint16_t           *out;     /* output slice, not shared with other jobs  */
+  size_t              count;   /* symbols to decode                         */
+  huff_job_fn         fn;      /* NULL: huff_decode_lsb_n()                 */
+  void               *user;    /* for fn                                    */
+  size_t              decoded; /* out: decoded symbols                      */
+  unsigned            err;     /* out: HUFF_OK or HUFF_ERR_*                */
+};
+
+/* jobs [next, end) of a worker, thieves take from the end */
+typedef struct huff_pool_range_t {
+  huff_mutex_t lock;
+  size_t       next;
+  size_t       end;
+} huff_pool_range_t;
+
+typedef struct huff_pool_t huff_pool_t;
+
+typedef struct huff_pool_worker_t {
+  huff_pool_t *pool;
+  unsigned     id;
+} huff_pool_worker_t;
+
+struct huff_pool_t {
+  huff_mutex_t        lock;
+  huff_cond_t         wake;     /* new batch or quit                        */
+  huff_cond_t         done;     /* last worker finished the batch           */
+  huff_thread_t      *threads;
+  huff_pool_worker_t *workers;
+  huff_pool_range_t  *ranges;   /* one per worker, caller is worker 0       */
+  huff_job_t         *jobs;
+  unsigned            nworkers; /* including caller                         */
+  unsigned            nthreads; /* started threads, nworkers - 1            */
+  unsigned            active;   /* threads still running current batch      */
+  unsigned            batch;    /* batch generation                         */
+  bool                quit;
+};
+
+HUFF_INLINE
+void
+huff_job_decode(huff_job_t * __restrict job) {
+  huff_reader_t r;
+
+  huff_reader_init(&r, job->in, job->in + job->in_len);
+  job->decoded = huff_decode_lsb_n(job->table, &r, job->out, job->count);
+
+  if (r.err)
+    job->err = r.err;
+  else
+    job->err = job->decoded < job->count ? HUFF_ERR_INPUT : HUFF_OK;
+}
+
+/* next job of worker id, steals half of another worker's jobs when empty */
+HUFF_INLINE
+bool
+huff_pool_take(huff_pool_t * __restrict pool, unsigned id, size_t *job) {
+  huff_pool_range_t *own, *victim;
+  size_t             next, end, mid;
+  unsigned           i;
+
+  own = &pool->ranges[id];
+
+  huff_mutex_lock(&own->lock);
+  if (own->next < own->end) {
+    *job = own->next++;
+    huff_mutex_unlock(&own->lock);
+    return true;
+  }
+  huff_mutex_unlock(&own->lock);
+
+  for (i = 1; i < pool->nworkers; i++) {
+    victim = &pool->ranges[(id + i) % pool->nworkers];
+
+    huff_mutex_lock(&victim->lock);
+    next = victim->next;
+    end  = victim->end;
+    if (next >= end) {
+      huff_mutex_unlock(&victim->lock);
+      continue;
+    }
+
+    mid         = next + (end - next) / 2;
+    victim->end = mid;
+    huff_mutex_unlock(&victim->lock);
+
+    /* run first stolen job, keep the rest for self or other thieves */
+    huff_mutex_lock(&own->lock);
+    own->next = mid + 1;
+    own->end  = end;
+    huff_mutex_unlock(&own->lock);
+
+    *job = mid;
+    return true;
+  }
+
+  return false;
+}
+
+HUFF_INLINE
+void
+huff_pool_run(huff_pool_t * __restrict pool, unsigned id) {
+  huff_job_t *job;
+  size_t      i;
+
+  while (huff_pool_take(pool, id, &i)) {
+    job = &pool->jobs[i];
+    if (job->fn)
+      job->fn(job);
+    else
+      huff_job_decode(job);
+  }
+}
+
+static inline void
+huff_pool_thread(void *arg) {
+  huff_pool_worker_t *worker;
+  huff_pool_t        *pool;
+  unsigned            seen;
+
+  worker = (huff_pool_worker_t *)arg;
+  pool   = worker->pool;
+  seen   = 0;
+
+  for (;;) {
+    huff_mutex_lock(&pool->lock);
+    while (pool->batch == seen && !pool->quit)
+      huff_cond_wait(&pool->wake, &pool->lock);
+
+    if (pool->quit) {
+      huff_mutex_unlock(&pool->lock);
+      return;
+    }
+
+    seen = pool->batch;
+    huff_mutex_unlock(&pool->lock);
+
+    huff_pool_run(pool, worker->id);
+
+    huff_mutex_lock(&pool->lock);
+    if (!--pool->active)
+      huff_cond_signal(&pool->done);
+    huff_mutex_unlock(&pool->lock);
+  }
+}
+
+/*!
+ * @brief Frees the pool, stops and joins its threads.
+ */
+HUFF_INLINE
+void
+huff_pool_free(huff_pool_t *pool) {
+  unsigned i;
+
+  if (!pool)
+    return;
+
+  huff_mutex_lock(&pool->lock);
+  pool->quit = true;
+  huff_cond_broadcast(&pool->wake);
+  huff_mutex_unlock(&pool->lock);
+
+  for (i = 0; i < pool->nthreads; i++)
+    huff_thread_join(pool->threads[i]);
+
+  for (i = 0; i < pool->nworkers; i++)
+    huff_mutex_destroy(&pool->ranges[i].lock);
+
+  huff_cond_destroy(&pool->done);
+  huff_cond_destroy(&pool->wake);
+  huff_mutex_destroy(&pool->lock);
+
+  free(pool->threads);
+  free(pool->workers);
+  free(pool->ranges);
+  free(pool);
+}
+
+/*!
+ * @brief Creates a pool of `nworkers` workers, the thread which calls
+ *        `huff_parallel_decode()` is one of them, so `nworkers - 1` threads
+ *        are started. 1 decodes on the calling thread only.
+ *
+ * @return pool or NULL on failure.
+ */
+HUFF_INLINE
+huff_pool_t*
+huff_pool_new(unsigned nworkers) {
+  huff_pool_t *pool;
+  unsigned     i;
+
+  if (!nworkers || !(pool = (huff_pool_t *)calloc(1, sizeof(*pool))))
+    return NULL;
+
+  pool->ranges  = (huff_pool_range_t *)calloc(nworkers, sizeof(*pool->ranges));
+  pool->workers = (huff_pool_worker_t *)calloc(nworkers, sizeof(*pool->workers));
+  pool->threads = (huff_thread_t *)calloc(nworkers, sizeof(*pool->threads));
+
+  if (!pool->ranges || !pool->workers || !pool->threads) {
+    free(pool->ranges);
+    free(pool->workers);
+    free(pool->threads);
+    free(pool);
+    return NULL;
+  }
+
+  huff_mutex_init(&pool->lock);
+  huff_cond_init(&pool->wake);
+  huff_cond_init(&pool->done);
+
+  pool->nworkers = nworkers;
+  for (i = 0; i < nworkers; i++) {
+    huff_mutex_init(&pool->ranges[i].lock);
+    pool->workers[i].pool = pool;
+    pool->workers[i].id   = i;
+  }
+
+  for (i = 1; i < nworkers; i++) {
+    if (!huff_thread_create(&pool->threads[i - 1], huff_pool_thread,
+                            &pool->workers[i])) {
+      huff_pool_free(pool);
+      return NULL;
+    }
+    pool->nthreads++;
+  }
+
+  return pool;
+}
+
+/*!
+ * @brief Runs `jobs` on the workers of `pool` and waits until all are done.
+ *
+ * Each job decodes `count` symbols of its segment into its output slice and
+ * stores `decoded` and `err`. Jobs are split into equal ranges one per
+ * worker, idle workers steal from busy ones, so segments of very different
+ * sizes still keep every worker busy.
+ *
+ * @return `true` if every job decoded all of its symbols without errors.
+ */
+HUFF_INLINE
+bool
+huff_parallel_decode(huff_pool_t * __restrict pool,
+                     huff_job_t  * __restrict jobs,
+                     size_t                   njobs) {
+  size_t   i, per, rem, start;
+  unsigned w;
+
+  per   = njobs / pool->nworkers;
+  rem   = njobs % pool->nworkers;
+  start = 0;
+
+  for (w = 0; w < pool->nworkers; w++) {
+    pool->ranges[w].next = start;
+    start               += per + (w < rem);
+    pool->ranges[w].end  = start;
+  }
+
+  huff_mutex_lock(&pool->lock);
+  pool->jobs   = jobs;
+  pool->active = pool->nthreads;
+  pool->batch++;
+  huff_cond_broadcast(&pool->wake);
+  huff_mutex_unlock(&pool->lock);
+
+  huff_pool_run(pool, 0);
+
+  huff_mutex_lock(&pool->lock);
+  while (pool->active)
+    huff_cond_wait(&pool->done, &pool->lock);
+  huff_mutex_unlock(&pool->lock);
+
+  for (i = 0; i < njobs; i++) {
+    if (jobs[i].err != HUFF_OK)
+      return false;
+  }
+
+  return true;
+}
+
+/*
+ * speculative decoding of a single stream: the stream is split into chunks at
+ * byte offsets, each chunk is decoded from its first bit as if a code starts
+ * there. canonical codes usually synchronize within a few symbols, the true
+ * decode of previous chunk reaches a symbol start of the speculative decode,
+ * from there both agree. only symbols until that point are decoded again.
+ */
+#define HUFF_SYNC_SYMS        256        /* symbol starts kept per chunk     */
+#define HUFF_SPEC_CHUNK_BYTES (64 * 1024) /* min chunk size                   */
+
+typedef struct huff_spec_chunk_t {
+  const huff_table_t *table;
+  const uint8_t      *in;
+  const uint8_t      *end;
+  uint16_t           *out;
+  size_t              start;  /* first bit, byte aligned                    */
+  size_t              limit;  /* first bit of next chunk                    */
+  size_t              stop;   /* first symbol start >= limit, speculative   */
+  size_t              nsyms;  /* speculative symbols                        */
+  size_t              from;   /* true first symbol start after stitching    */
+  size_t              count;  /* true symbols of chunk                      */
+  unsigned            err;    /* invalid code, true after a failed stitch   */
+  uint32_t            npos;
+  size_t              pos[HUFF_SYNC_SYMS]; /* first symbol starts - start   */
+} huff_spec_chunk_t;
+
+/* decodes and skips a symbol, 0 if input ended or code is invalid */
+HUFF_INLINE
+unsigned
+huff_spec_step(const huff_table_t * __restrict table,
+               huff_reader_t      * __restrict r,
+               unsigned           * __restrict err) {
+  uint8_t used;
+
+  if (r->nbits < HUFF_MAX_CODE_LENGTH)
+    huff_reader_refill(r);
+
+  huff_decode_lsb(table, r->bits, (uint8_t)r->nbits, &used);
+  if (unlikely(!used || used > r->nbits)) {
+    *err = !used && r->nbits >= HUFF_MAX_CODE_LENGTH ? HUFF_ERR_CODE : HUFF_OK;
+    return 0;
+  }
+
+  huff_reader_consume(r, used);
+  return used;
+}
+
+static inline void
+huff_spec_scan(huff_job_t *job) {
+  huff_spec_chunk_t *c;
+  huff_reader_t      r;
+  size_t             pos, n;
+  unsigned           used;
+
+  c      = (huff_spec_chunk_t *)job->user;
+  c->err = HUFF_OK;
+  pos    = c->start;
+  n      = 0;
+
+  huff_reader_seek(&r, c->in, c->end, pos);
+
+  while (pos < c->limit) {
+    if (!(used = huff_spec_step(c->table, &r, &c->err)))
+      break;
+
+    if (n < HUFF_SYNC_SYMS)
+      c->pos[n] = pos - c->start;
+
+    pos += used;
+    n++;
+  }
+
+  c->npos  = (uint32_t)(n < HUFF_SYNC_SYMS ? n : HUFF_SYNC_SYMS);
+  c->nsyms = n;
+  c->stop  = pos;
+  job->err = HUFF_OK;
+}
+
+static inline void
+huff_spec_fill(huff_job_t *job) {
+  huff_spec_chunk_t *c;
+  huff_reader_t      r;
+
+  c = (huff_spec_chunk_t *)job->user;
+  huff_reader_seek(&r, c->in, c->end, c->from);
+
+  /* count symbols are known to be valid, a shortfall is a bug */
+  job->decoded = huff_decode_lsb_n(c->table, &r, c->out, c->count);
+  job->err     = r.err ? r.err
+                       : job->decoded == c->count ? HUFF_OK : HUFF_ERR_CODE;
+}
+
+/*
+ * finds true symbols of chunk c which starts at bit *pos: decodes until a
+ * symbol start agrees with the speculative decode or the chunk ends.
+ *
+ * returns false if decoding has to stop, c->err is then HUFF_ERR_CODE for an
+ * invalid code and HUFF_OK for end of input.
+ */
+HUFF_INLINE
+bool
+huff_spec_stitch(huff_spec_chunk_t * __restrict c, size_t * __restrict pos) {
+  huff_reader_t r;
+  size_t        p, x, rel;
+  unsigned      used, err;
+  uint32_t      j;
+
+  p        = *pos;
+  x        = 0;
+  j        = 0;
+  c->from  = p;
+  c->count = 0;
+
+  if (p >= c->limit)
+    return true;
+
+  huff_reader_seek(&r, c->in, c->end, p);
+
+  for (;;) {
+    rel = p - c->start;
+    while (j < c->npos && c->pos[j] < rel)
+      j++;
+
+    /* synchronized, rest of speculative decode is true */
+    if (j < c->npos && c->pos[j] == rel) {
+      c->count = x + (c->nsyms - j);
+      *pos     = c->stop;
+      return !c->err && c->stop >= c->limit;
+    }
+
+    if (p >= c->limit)
+      break;
+
+    err = HUFF_OK;
+    if (!(used = huff_spec_step(c->table, &r, &err))) {
+      c->count = x;
+      c->err   = err;
+      *pos     = p;
+      return false;
+    }
+
+    p += used;
+    x++;
+  }
+
+  c->count = x;
+  *pos     = p;
+  return true;
+}
+
+/*!
+ * @brief Decodes up to `count` symbols of a single stream on all workers of
+ *        `pool` by speculative decoding and self-synchronization.
+ *
+ * The stream is split into chunks of at least `HUFF_SPEC_CHUNK_BYTES`. Each
+ * worker decodes its chunks from their first byte, then previous chunks are
+ * followed across each chunk boundary until they agree with the speculative
+ * decode, usually after a few symbols; only those are decoded sequentially.
+ * Finally each chunk writes its symbols at their final offset in parallel.
+ * Output and `err` are the same as of `huff_decode_lsb_n()` and its reader.
+ *
+ * @param[out] err  `HUFF_ERR_CODE` if decoding stopped at an invalid code
+ *                  before `count` symbols, otherwise `HUFF_OK`.
+ *
+ * @return Number of decoded symbols, less than `count` if input ended or an
+ *         invalid code is found.
+ */
+HUFF_INLINE
+size_t
+huff_parallel_decode_lsb(huff_pool_t        * __restrict pool,
+                         const huff_table_t * __restrict table,
+                         const uint8_t      * __restrict in,
+                         size_t                          in_len,
+                         uint16_t           * __restrict out,
+                         size_t                          count,
+                         unsigned           * __restrict err) {
+  huff_spec_chunk_t *chunks;
+  huff_job_t        *jobs;
+  huff_reader_t      r;
+  size_t             k, nchunks, total, pos;
+  bool               more;
+
+  nchunks = in_len / HUFF_SPEC_CHUNK_BYTES;
+  if (nchunks > (size_t)pool->nworkers * 4)
+    nchunks = (size_t)pool->nworkers * 4;
+
+  chunks = NULL;
+  jobs   = NULL;
+
+  if (nchunks < 2
+      || !(chunks = (huff_spec_chunk_t *)malloc(nchunks * sizeof(*chunks)))
+      || !(jobs   = (huff_job_t *)calloc(nchunks, sizeof(*jobs)))) {
+    free(chunks);
+    huff_reader_init(&r, in, in + in_len);
+    total = huff_decode_lsb_n(table, &r, out, count);
+    *err  = r.err;
+    return total;
+  }
+
+  for (k = 0; k < nchunks; k++) {
+    chunks[k].table = table;
+    chunks[k].in    = in;
+    chunks[k].end   = in + in_len;
+    chunks[k].start = in_len * k / nchunks * 8;
+    chunks[k].limit = in_len * (k + 1) / nchunks * 8;
+    jobs[k].fn      = huff_spec_scan;
+    jobs[k].user    = &chunks[k];
+  }
+
+  huff_parallel_decode(pool, jobs, nchunks);
+
+  /* stitch chunks in order, true decode of chunk k starts at pos */
+  *err = HUFF_OK;
+  for (k = 0, pos = 0, total = 0; k < nchunks; k++) {
+    more          = huff_spec_stitch(&chunks[k], &pos);
+    chunks[k].out = out + total;
+
+    if (chunks[k].count > count - total)
+      chunks[k].count = count - total;
+
+    total += chunks[k].count;
+    jobs[k].fn = huff_spec_fill;
+
+    if (!more || total == count) {
+      /* symbols up to count were decoded before stopping */
+      if (!more && total < count)
+        *err = chunks[k].err;
+
+      for (k++; k < nchunks; k++) {
+        chunks[k].count = 0;
+        chunks[k].out   = out + total;
+        jobs[k].fn      = huff_spec_fill;
+      }
+      break;
+    }
+  }
+
+  if (!huff_parallel_decode(pool, jobs, nchunks)) {
+    /* output up to the first failing chunk is valid */
+    for (k = 0; !jobs[k].err; k++);
+    total = (size_t)(chunks[k].out - out) + jobs[k].decoded;
+    *err  = jobs[k].err;
+  }
+
+  free(jobs);
+  free(chunks);
+  return total;
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* huff_parallel_h */
@@ -26,6 +26,76 @@ extern "C" {
 #include <immintrin.h>
 #endif
 
+#include <string.h>
+
+/* sticky reader errors, see huff_reader_status() */
+#define HUFF_OK               0
+#define HUFF_ERR_CODE         1 /* invalid code in input                    */
+#define HUFF_ERR_INPUT        2 /* more bits decoded than input has         */
+
+/*
+ * bit reservoir for decoding many symbols, bits are consumed from LSB.
+ * bits above nbits may hold next input bits which are not counted yet.
+ */
+typedef struct huff_reader_t {
+  const uint8_t *p;     /* next byte to load                                */
+  const uint8_t *end;   /* end of input                                     */
+  bitstream_t    bits;  /* reservoir, next bit is LSB                       */
+  unsigned       nbits; /* number of valid bits in reservoir                */
+  unsigned       pad;   /* zero bytes added past end by refill_pad          */
+  unsigned       err;   /* first error, HUFF_OK if none                     */
+} huff_reader_t;
+
+HUFF_INLINE
+uint64_t
+huff_load64le(const uint8_t * __restrict p) {
+  uint64_t v;
+  memcpy(&v, p, sizeof(v));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  v = __builtin_bswap64(v);
+#endif
+  return v;
+}
+
+HUFF_INLINE
+uint64_t
+huff_load64be(const uint8_t * __restrict p) {
+  uint64_t v;
+  memcpy(&v, p, sizeof(v));
+#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#  if defined(_MSC_VER) && !defined(__clang__)
+  v = _byteswap_uint64(v);
+#  else
+  v = __builtin_bswap64(v);
+#  endif
+#endif
+  return v;
+}
+
+/*
+ * bits in reservoir after a refill which doesn't hit end of input: 56 with
+ * 64-bit reservoir, 120 with HUFF_ENABLE_BIG_BITSTREAM. refills load
+ * HUFF_REFILL_LOAD bytes at once.
+ */
+#ifdef HUFF_WIDE_BITSTREAM
+#  define HUFF_REFILL_BITS    120
+#  define HUFF_REFILL_LOAD    16
+#else
+#  define HUFF_REFILL_BITS    56
+#  define HUFF_REFILL_LOAD    8
+#endif
+
+/* HUFF_REFILL_LOAD bytes (LSB-first) as a reservoir word */
+HUFF_INLINE
+bitstream_t
+huff_load_bits(const uint8_t * __restrict p) {
+#ifdef HUFF_WIDE_BITSTREAM
+  return ((bitstream_t)huff_load64le(p + 8) << 64) | huff_load64le(p);
+#else
+  return (bitstream_t)huff_load64le(p);
+#endif
+}
+
 HUFF_INLINE
 int
 huff_read_scalar(const uint8_t ** __restrict buff,
@@ -68,22 +138,18 @@ huff_read_neon(const uint8_t ** __restrict buff,
   maxb    = (int)sizeof(bitstream_t);
   n       = ((int)remb < maxb) ? (int)remb : maxb;
 
-#ifdef ENABLE_BIG_BITSTREAM
-  // For 128-bit mode, load two 64-bit chunks
-  uint8x16_t bytes = vld1q_u8(p);
-  uint64x2_t chunks = vreinterpretq_u64_u8(bytes);
-
-  // Extract both 64-bit halves
-  uint64_t low = vgetq_lane_u64(chunks, 0);
-  uint64_t high = vgetq_lane_u64(chunks, 1);
+  /* wide load only if it stays inside the input */
+  if (unlikely(remb < sizeof(bitstream_t)))
+    return huff_read_scalar(buff, bits, end);
 
-  // Combine into 128-bit result
-  result = (((bitstream_t)high) << 64) | low;
+#ifdef HUFF_WIDE_BITSTREAM
+  {
+    uint64x2_t chunks = vreinterpretq_u64_u8(vld1q_u8(p));
+    result = ((bitstream_t)vgetq_lane_u64(chunks, 1) << 64)
+           | vgetq_lane_u64(chunks, 0);
+  }
 #else
-  // For 64-bit mode, load single 64-bit chunk
-  uint8x8_t bytes = vld1_u8(p);
-  uint64x1_t chunk = vreinterpret_u64_u8(bytes);
-  result = vget_lane_u64(chunk, 0);
+  result = vget_lane_u64(vreinterpret_u64_u8(vld1_u8(p)), 0);
 #endif
 
   *buff   += n;
@@ -108,28 +174,18 @@ huff_read_sse(const uint8_t ** __restrict buff,
   n       = ((int)remb < maxb) ? (int)remb : maxb;
   result  = 0;
 
-#ifdef ENABLE_BIG_BITSTREAM
-  // For 128-bit mode, load entire 128 bits at once
-  __m128i bytes = _mm_loadu_si128((__m128i*)p);
-
-#if defined(__SIZEOF_INT128__)
-  // Extract both 64-bit halves and combine
-  uint64_t low = _mm_cvtsi128_si64(bytes);
-  __m128i high_vec = _mm_srli_si128(bytes, 8);
-  uint64_t high = _mm_cvtsi128_si64(high_vec);
+  /* wide load only if it stays inside the input */
+  if (unlikely(remb < sizeof(__m128i)))
+    return huff_read_scalar(buff, bits, end);
 
-  result = (((bitstream_t)high) << 64) | low;
-#else
-  // If 128-bit integers aren't supported, fall back to scalar
-  unsigned char *bytes_ptr = (unsigned char *)&bytes;
-  for (int i = 0; i < n; i++) {
-    result |= ((bitstream_t)bytes_ptr[i]) << (i * 8);
+#ifdef HUFF_WIDE_BITSTREAM
+  {
+    __m128i bytes = _mm_loadu_si128((const __m128i *)p);
+    result = ((bitstream_t)_mm_cvtsi128_si64(_mm_srli_si128(bytes, 8)) << 64)
+           | (uint64_t)_mm_cvtsi128_si64(bytes);
   }
-#endif
-
 #else
-  // For 64-bit mode, just extract lower 64 bits
-  result = _mm_cvtsi128_si64(_mm_loadu_si128((__m128i*)p));
+  result = (uint64_t)_mm_cvtsi128_si64(_mm_loadu_si128((const __m128i *)p));
 #endif
 
   *buff   += n;
@@ -155,30 +211,20 @@ huff_read_avx2(const uint8_t ** __restrict buff,
   n       = ((int)remb < maxb) ? (int)remb : maxb;
   result  = 0;
 
-#ifdef ENABLE_BIG_BITSTREAM
-  // For 128-bit mode, use AVX2 for loading
-  __m256i bytes = _mm256_loadu_si256((__m256i*)p);
-  __m128i lower = _mm256_extracti128_si256(bytes, 0);
+  /* wide load only if it stays inside the input */
+  if (unlikely(remb < sizeof(__m256i)))
+    return huff_read_scalar(buff, bits, end);
 
-#if defined(__SIZEOF_INT128__)
-  // Extract both 64-bit halves and combine
-  uint64_t low = _mm_cvtsi128_si64(lower);
-  __m128i high_vec = _mm_srli_si128(lower, 8);
-  uint64_t high = _mm_cvtsi128_si64(high_vec);
-
-  result = (((bitstream_t)high) << 64) | low;
-#else
-  // If 128-bit integers aren't supported, fall back to scalar
-  unsigned char *bytes_ptr = (unsigned char *)&lower;
-  for (int i = 0; i < n; i++) {
-    result |= ((bitstream_t)bytes_ptr[i]) << (i * 8);
+#ifdef HUFF_WIDE_BITSTREAM
+  {
+    __m128i lower;
+    lower  = _mm256_castsi256_si128(_mm256_loadu_si256((const __m256i *)p));
+    result = ((bitstream_t)_mm_cvtsi128_si64(_mm_srli_si128(lower, 8)) << 64)
+           | (uint64_t)_mm_cvtsi128_si64(lower);
   }
-#endif
-
 #else
-  // For 64-bit mode, extract lower 64 bits
-  __m128i lower = _mm256_extracti128_si256(_mm256_loadu_si256((__m256i*)p), 0);
-  result = _mm_cvtsi128_si64(lower);
+  result = (uint64_t)_mm_cvtsi128_si64(
+             _mm256_castsi256_si128(_mm256_loadu_si256((const __m256i *)p)));
 #endif
 
   *buff   += n;
@@ -205,6 +251,154 @@ huff_read(const uint8_t ** __restrict buff,
 #endif
 }
 
+HUFF_INLINE
+void
+huff_reader_init(huff_reader_t * __restrict reader,
+                 const uint8_t * __restrict buff,
+                 const uint8_t * __restrict end) {
+  reader->p     = buff;
+  reader->end   = end;
+  reader->bits  = 0;
+  reader->nbits = 0;
+  reader->pad   = 0;
+  reader->err   = HUFF_OK;
+}
+
+/*!
+ * @brief Refills the reservoir (LSB-first) to at least `HUFF_REFILL_BITS`
+ *        bits if possible.
+ *
+ * A single unaligned `HUFF_REFILL_LOAD` byte load is used while the input has
+ * that many bytes, no branch depends on how many bits were consumed. Near the
+ * end bytes are loaded one by one, so input is never read past `end`.
+ */
+HUFF_INLINE
+void
+huff_reader_refill(huff_reader_t * __restrict reader) {
+  HUFF_STAT_REFILL();
+  if (likely(reader->end - reader->p >= HUFF_REFILL_LOAD)) {
+    HUFF_STAT_BYTES((HUFF_BITSTREAM_BITS - 1 - reader->nbits) >> 3);
+    reader->bits  |= huff_load_bits(reader->p) << reader->nbits;
+    reader->p     += (HUFF_BITSTREAM_BITS - 1 - reader->nbits) >> 3;
+    reader->nbits |= HUFF_REFILL_BITS;
+  } else {
+    while (reader->nbits <= HUFF_REFILL_BITS && reader->p < reader->end) {
+      HUFF_STAT_BYTES(1);
+      reader->bits  |= (bitstream_t)*reader->p++ << reader->nbits;
+      reader->nbits += 8;
+    }
+  }
+}
+
+/*!
+ * @brief Same as `huff_reader_refill()` but supplies zero bytes after `end`,
+ *        so there are always at least `HUFF_REFILL_BITS` bits in the
+ *        reservoir.
+ *
+ * Loops can decode without checking remaining bits per symbol, even near the
+ * end of the input, and check `huff_reader_overrun()` once when done. Input
+ * is still never read past `end`.
+ */
+HUFF_INLINE
+void
+huff_reader_refill_pad(huff_reader_t * __restrict reader) {
+  HUFF_STAT_REFILL();
+  if (likely(reader->end - reader->p >= HUFF_REFILL_LOAD)) {
+    HUFF_STAT_BYTES((HUFF_BITSTREAM_BITS - 1 - reader->nbits) >> 3);
+    reader->bits  |= huff_load_bits(reader->p) << reader->nbits;
+    reader->p     += (HUFF_BITSTREAM_BITS - 1 - reader->nbits) >> 3;
+    reader->nbits |= HUFF_REFILL_BITS;
+  } else {
+    while (reader->nbits <= HUFF_REFILL_BITS) {
+      if (reader->p < reader->end) {
+        HUFF_STAT_BYTES(1);
+        reader->bits |= (bitstream_t)*reader->p++ << reader->nbits;
+      } else {
+        reader->pad++;
+      }
+      reader->nbits += 8;
+    }
+  }
+}
+
+/*!
+ * @brief Returns true if zero padding of `huff_reader_refill_pad()` has been
+ *        consumed, i.e. more bits were decoded than the input has.
+ */
+HUFF_INLINE
+bool
+huff_reader_overrun(const huff_reader_t * __restrict reader) {
+  return reader->pad * 8 > reader->nbits;
+}
+
+/*!
+ * @brief Records an error and stops the reader, the first error is kept.
+ *
+ * The reservoir is emptied and marked as overrun, so loops which decode until
+ * `huff_reader_overrun()` end too.
+ */
+HUFF_INLINE
+void
+huff_reader_fail(huff_reader_t * __restrict reader, unsigned err) {
+  if (!reader->err)
+    reader->err = err;
+
+  reader->p     = reader->end;
+  reader->bits  = 0;
+  reader->nbits = 0;
+  reader->pad   = 1;
+}
+
+/*!
+ * @brief Returns the first error of a reader: `HUFF_ERR_CODE` for invalid
+ *        codes, `HUFF_ERR_INPUT` if padding of `huff_reader_refill_pad()` is
+ *        consumed, otherwise `HUFF_OK`.
+ */
+HUFF_INLINE
+unsigned
+huff_reader_status(const huff_reader_t * __restrict reader) {
+  if (reader->err)
+    return reader->err;
+
+  return huff_reader_overrun(reader) ? HUFF_ERR_INPUT : HUFF_OK;
+}
+
+/*!
+ * @brief Drops `n` bits from the reservoir, `n` must be less than 64.
+ */
+HUFF_INLINE
+void
+huff_reader_consume(huff_reader_t * __restrict reader, unsigned n) {
+#ifdef HUFF_WIDE_BITSTREAM
+  uint64_t lo, hi;
+
+  /* compilers shift 128-bit by any n with a branch or cmov, n < 64 here */
+  lo = (uint64_t)reader->bits;
+  hi = (uint64_t)(reader->bits >> 64);
+  lo = (lo >> n) | ((hi << 1) << (63 - n));
+  reader->bits = ((bitstream_t)(hi >> n) << 64) | lo;
+#else
+  reader->bits  >>= n;
+#endif
+  reader->nbits  -= n;
+}
+
+/*!
+ * @brief Initializes a reader at bit `bit` of input `in`.
+ */
+HUFF_INLINE
+void
+huff_reader_seek(huff_reader_t * __restrict reader,
+                 const uint8_t * __restrict in,
+                 const uint8_t * __restrict end,
+                 size_t                     bit) {
+  huff_reader_init(reader, in + (bit >> 3), end);
+  huff_reader_refill(reader);
+
+  if (reader->nbits >= (bit & 7))
+    huff_reader_consume(reader, (unsigned)(bit & 7));
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,8 +14,8 @@
  * limitations under the License.
  */
 
-#ifndef huff_msb_h
-#define huff_msb_h
+#ifndef huff_rev_h
+#define huff_rev_h
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -53,7 +53,21 @@ static inline uint8_t huff_rev8full(uint8_t b) {
 #endif
 }
 
+/* reverse low len bits of v, len in [1, 16] */
+static inline uint16_t huff_rev16(uint16_t v, int len) {
+#if (defined(__GNUC__) && (__GNUC__ > 14 || (__GNUC__ == 14 && __GNUC_MINOR__ >= 0))) || \
+    (defined(__clang__) && __has_builtin(__builtin_bitreverse16))
+  return (uint16_t)(__builtin_bitreverse16(v) >> (16 - len));
+#else
+  v = (uint16_t)((v & 0xFF00) >> 8 | (v & 0x00FF) << 8);
+  v = (uint16_t)((v & 0xF0F0) >> 4 | (v & 0x0F0F) << 4);
+  v = (uint16_t)((v & 0xCCCC) >> 2 | (v & 0x3333) << 2);
+  v = (uint16_t)((v & 0xAAAA) >> 1 | (v & 0x5555) << 1);
+  return (uint16_t)(v >> (16 - len));
+#endif
+}
+
 #ifdef __cplusplus
 }
 #endif
-#endif /* huff_msb_h */
+#endif /* huff_rev_h */
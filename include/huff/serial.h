@@ -0,0 +1,467 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * serialized tables: a built table is stored as a 32 byte header followed by
+ * the right sized table and, for extended tables, its extra bits info. tables
+ * have no pointers except the extras of extended tables, so a blob which is
+ * read or mapped (32 byte aligned, e.g. mmap) is used in place after
+ * huff_table_load_*() checked it.
+ *
+ * blobs are in host byte order and layout, a blob of another byte order,
+ * pointer size or version is rejected on load.
+ */
+
+#ifndef huff_serial_h
+#define huff_serial_h
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <string.h>
+
+#define HUFF_SERIAL_MAGIC     0x54465548U /* "HUFT" in little endian        */
+#define HUFF_SERIAL_VERSION   1
+
+#define HUFF_SERIAL_LSB       1           /* huff_table_t, LSB-first        */
+#define HUFF_SERIAL_MSB       2           /* huff_table_t, MSB-first        */
+#define HUFF_SERIAL_EXT       3           /* huff_table_ext_t, LSB-first    */
+
+typedef struct huff_serial_t {
+  uint32_t magic;      /* HUFF_SERIAL_MAGIC in host byte order              */
+  uint16_t version;    /* HUFF_SERIAL_VERSION                               */
+  uint8_t  kind;       /* HUFF_SERIAL_LSB, _MSB or _EXT                     */
+  uint8_t  entry_size; /* size of a fast table entry                        */
+  uint16_t fast_off;   /* offset of fast entries in table                   */
+  uint16_t nsyms;      /* symbols after fast entries                        */
+  uint16_t nextras;    /* huff_ext_t entries after table                    */
+  uint16_t reserved;
+  uint32_t table_size; /* bytes of table, multiple of 32                    */
+  uint32_t size;       /* bytes of header, table and extras                 */
+  uint64_t check;      /* hash of table (except extras pointer) and extras  */
+} huff_serial_t;
+
+/* used symbols in canonical order, offsets[l] + sentinels[l] for l = 16 */
+HUFF_INLINE
+uint16_t
+huff_table_nsyms(const uint16_t sentinels[HUFF_MAX_CODE_LENGTH + 1],
+                 const uint16_t offsets[HUFF_MAX_CODE_LENGTH + 1]) {
+  return (uint16_t)(offsets[HUFF_MAX_CODE_LENGTH]
+                    + sentinels[HUFF_MAX_CODE_LENGTH]);
+}
+
+HUFF_INLINE
+uint64_t
+huff_serial_hash(uint64_t h, const void * __restrict p, size_t n) {
+  const uint8_t *b;
+  uint64_t       w, lane[4];
+  size_t         i, k;
+
+  b = (const uint8_t *)p;
+
+  /* 4 independent lanes of 8 bytes, then the rest */
+  for (k = 0; k < 4; k++)
+    lane[k] = h + k;
+
+  for (i = 0; i + 32 <= n; i += 32) {
+    for (k = 0; k < 4; k++) {
+      memcpy(&w, b + i + k * 8, 8);
+      lane[k]  = (lane[k] ^ w) * 0x100000001b3ULL;
+      lane[k] ^= lane[k] >> 29;
+    }
+  }
+
+  for (k = 0; k < 4; k++)
+    h = (h ^ lane[k]) * 0x100000001b3ULL;
+
+  for (; i < n; i++)
+    h = (h ^ b[i]) * 0x100000001b3ULL;
+
+  return h ^ (h >> 29);
+}
+
+/* hash of table and extras, extras pointer is skipped (patched on load) */
+HUFF_INLINE
+uint64_t
+huff_serial_check(const uint8_t * __restrict blob,
+                  const huff_serial_t       *hdr) {
+  const uint8_t *table;
+  uint64_t       h;
+  size_t         skip;
+
+  table = blob + sizeof(*hdr);
+  h     = 0xcbf29ce484222325ULL ^ hdr->kind;
+
+  if (hdr->kind == HUFF_SERIAL_EXT) {
+    skip = offsetof(huff_table_ext_t, extras);
+    h    = huff_serial_hash(h, table, skip);
+    skip += sizeof(((huff_table_ext_t *)0)->extras);
+    h    = huff_serial_hash(h, table + skip, hdr->size - sizeof(*hdr) - skip);
+    return h;
+  }
+
+  return huff_serial_hash(h, table, hdr->table_size);
+}
+
+HUFF_INLINE
+size_t
+huff_serial_save(const void       * __restrict table,
+                 uint8_t                       kind,
+                 size_t                        fast_off,
+                 size_t                        entry_size,
+                 uint16_t                      nfast,
+                 uint16_t                      nsyms,
+                 const huff_ext_t * __restrict extras,
+                 uint16_t                      nextras,
+                 void             * __restrict out,
+                 size_t                        cap) {
+  huff_serial_t hdr;
+  uint8_t      *p;
+  size_t        used;
+
+  used = fast_off + (size_t)nfast * entry_size + (size_t)nsyms * sizeof(uint16_t);
+
+  memset(&hdr, 0, sizeof(hdr));
+  hdr.magic      = HUFF_SERIAL_MAGIC;
+  hdr.version    = HUFF_SERIAL_VERSION;
+  hdr.kind       = kind;
+  hdr.entry_size = (uint8_t)entry_size;
+  hdr.fast_off   = (uint16_t)fast_off;
+  hdr.nsyms      = nsyms;
+  hdr.nextras    = nextras;
+  hdr.table_size = (uint32_t)((used + 31) & ~(size_t)31);
+  hdr.size       = (uint32_t)(sizeof(hdr) + hdr.table_size
+                              + (size_t)nextras * sizeof(huff_ext_t));
+
+  if (!out)
+    return hdr.size;
+
+  if (cap < hdr.size)
+    return 0;
+
+  p = (uint8_t *)out;
+  memcpy(p + sizeof(hdr), table, used);
+  memset(p + sizeof(hdr) + used, 0, hdr.table_size - used);
+
+  if (kind == HUFF_SERIAL_EXT) {
+    memset(p + sizeof(hdr) + offsetof(huff_table_ext_t, extras), 0,
+           sizeof(((huff_table_ext_t *)0)->extras));
+    if (nextras)
+      memcpy(p + sizeof(hdr) + hdr.table_size, extras,
+             nextras * sizeof(huff_ext_t));
+  }
+
+  hdr.check = huff_serial_check(p, &hdr);
+  memcpy(p, &hdr, sizeof(hdr));
+  return hdr.size;
+}
+
+/*!
+ * @brief Serializes a table built by `huff_init_lsb*()` or `huff_init_msb*()`.
+ *
+ * @param[in]  table  Table, full or right sized.
+ * @param[in]  kind   `HUFF_SERIAL_LSB` or `HUFF_SERIAL_MSB`.
+ * @param[out] out    Blob or `NULL` to get its size.
+ * @param[in]  cap    Size of `out`.
+ *
+ * @return bytes of blob, 0 if `cap` is too small.
+ */
+HUFF_INLINE
+size_t
+huff_table_save(const huff_table_t * __restrict table,
+                uint8_t                         kind,
+                void               * __restrict out,
+                size_t                          cap) {
+  return huff_serial_save(table, kind, offsetof(huff_table_t, fast),
+                          sizeof(table->fast[0]), table->nfast,
+                          huff_table_nsyms(table->sentinels, table->offsets),
+                          NULL, 0, out, cap);
+}
+
+/*!
+ * @brief Serializes a table built by `huff_init_lsb_ext*()`, with the extra
+ *        bits info of its symbols.
+ *
+ * @return bytes of blob, 0 if `cap` is too small.
+ */
+HUFF_INLINE
+size_t
+huff_table_ext_save(const huff_table_ext_t * __restrict table,
+                    void                   * __restrict out,
+                    size_t                              cap) {
+  const uint16_t *syms;
+  uint16_t        nsyms, nextras, i;
+  int             x;
+
+  nsyms   = huff_table_nsyms(table->sentinels, table->offsets);
+  syms    = huff_table_syms(table);
+  nextras = 0;
+
+  for (i = 0; i < nsyms; i++) {
+    x = (int)syms[i] - table->offset;
+    if (x >= nextras)
+      nextras = (uint16_t)(x + 1);
+  }
+
+  return huff_serial_save(table, HUFF_SERIAL_EXT,
+                          offsetof(huff_table_ext_t, fast),
+                          sizeof(table->fast[0]), table->nfast, nsyms,
+                          table->extras, nextras, out, cap);
+}
+
+/* header and layout, table is at blob + 32 */
+HUFF_INLINE
+const uint8_t*
+huff_serial_check_header(const void     * __restrict blob,
+                         size_t                      size,
+                         uint8_t                     kind,
+                         size_t                      fast_off,
+                         size_t                      entry_size,
+                         huff_serial_t  * __restrict hdr) {
+  const uint8_t *p;
+
+  p = (const uint8_t *)blob;
+  if (!p || ((uintptr_t)p & 31) || size < sizeof(*hdr))
+    return NULL;
+
+  memcpy(hdr, p, sizeof(*hdr));
+  if (hdr->magic         != HUFF_SERIAL_MAGIC
+      || hdr->version    != HUFF_SERIAL_VERSION
+      || hdr->kind       != kind
+      || hdr->entry_size != entry_size
+      || hdr->fast_off   != fast_off
+      || hdr->nsyms      >  HUFF_MAX_CODES
+      || (hdr->table_size & 31)
+      || hdr->table_size <  fast_off
+      || hdr->size       >  size
+      || hdr->size       != sizeof(*hdr) + (size_t)hdr->table_size
+                            + (size_t)hdr->nextras * sizeof(huff_ext_t)
+      || hdr->check      != huff_serial_check(p, hdr))
+    return NULL;
+
+  return p + sizeof(*hdr);
+}
+
+/*
+ * slow path reads syms[offsets[l] + code] for windows of invalid entries,
+ * checks all 16 bit windows (first bit is MSB) with given prefix of k bits
+ */
+HUFF_INLINE
+bool
+huff_serial_check_slow(const uint16_t sentinels[HUFF_MAX_CODE_LENGTH + 1],
+                       const uint16_t offsets[HUFF_MAX_CODE_LENGTH + 1],
+                       unsigned       fast_bits,
+                       unsigned       nsyms,
+                       uint32_t       prefix,
+                       unsigned       k) {
+  uint32_t w, end;
+  unsigned l;
+
+  w   = prefix << (HUFF_MAX_CODE_LENGTH - k);
+  end = (prefix + 1) << (HUFF_MAX_CODE_LENGTH - k);
+
+  for (; w < end; w++) {
+    l = huff_code_length(sentinels, (uint16_t)w, fast_bits);
+    if (l && (uint16_t)(offsets[l] + (w >> (HUFF_MAX_CODE_LENGTH - l))) >= nsyms)
+      return false;
+  }
+
+  return true;
+}
+
+/*
+ * entries of both table kinds start with len, sub, sym. links must point
+ * into the table and windows which end up in the slow path must find their
+ * symbols in syms. complete codes have no such windows.
+ */
+HUFF_INLINE
+bool
+huff_serial_check_table(const uint8_t  * __restrict fast,
+                        size_t                      entry_size,
+                        const huff_serial_t        *hdr,
+                        const uint16_t              sentinels[HUFF_MAX_CODE_LENGTH + 1],
+                        const uint16_t              offsets[HUFF_MAX_CODE_LENGTH + 1],
+                        unsigned                    nfast,
+                        unsigned                    fast_bits,
+                        bool                        lsb) {
+  huff_fast_entry_t fe, se;
+  unsigned          i, j, q, r, sub;
+
+  if (fast_bits < 1 || fast_bits > HUFF_FAST_TABLE_BITS
+      || nfast < (1U << fast_bits) || nfast > HUFF_TABLE_ENTRIES
+      || hdr->fast_off + (size_t)nfast * entry_size
+         + (size_t)hdr->nsyms * sizeof(uint16_t) > hdr->table_size
+      || huff_table_nsyms(sentinels, offsets) != hdr->nsyms)
+    return false;
+
+  for (j = 0; j < (1U << fast_bits); j++) {
+    memcpy(&fe, fast + (size_t)j * entry_size, sizeof(fe));
+
+    if (likely(fe.len)) {
+      if (unlikely(fe.len > HUFF_MAX_CODE_LENGTH))
+        return false;
+      continue;
+    }
+
+    /* prefix as it is read, MSB-first */
+    i = lsb ? huff_rev16((uint16_t)j, (int)fast_bits) : j;
+
+    if (!fe.sub) {
+      if (!huff_serial_check_slow(sentinels, offsets, fast_bits, hdr->nsyms,
+                                  i, fast_bits))
+        return false;
+      continue;
+    }
+
+    sub = fe.sub;
+    if (sub > HUFF_MAX_CODE_LENGTH - fast_bits
+        || (uint32_t)fe.sym + (1U << sub) > nfast)
+      return false;
+
+    for (q = 0; q < (1U << sub); q++) {
+      memcpy(&se, fast + (size_t)(fe.sym + q) * entry_size, sizeof(se));
+
+      if (likely(se.len)) {
+        if (unlikely(se.len > HUFF_MAX_CODE_LENGTH))
+          return false;
+        continue;
+      }
+
+      r = lsb ? huff_rev16((uint16_t)q, (int)sub) : q;
+      if (!huff_serial_check_slow(sentinels, offsets, fast_bits, hdr->nsyms,
+                                  (i << sub) | r, fast_bits + sub))
+        return false;
+    }
+  }
+
+  return true;
+}
+
+HUFF_INLINE
+const huff_table_t*
+huff_table_load(const void * __restrict blob, size_t size, uint8_t kind) {
+  const huff_table_t *table;
+  huff_serial_t       hdr;
+  const uint8_t      *p;
+
+  p = huff_serial_check_header(blob, size, kind, offsetof(huff_table_t, fast),
+                               sizeof(table->fast[0]), &hdr);
+  if (!p || hdr.nextras)
+    return NULL;
+
+  table = (const huff_table_t *)(const void *)p;
+  if (!huff_serial_check_table(p + hdr.fast_off, sizeof(table->fast[0]), &hdr,
+                               table->sentinels, table->offsets, table->nfast,
+                               table->bits, kind == HUFF_SERIAL_LSB))
+    return NULL;
+
+  return table;
+}
+
+/*!
+ * @brief Checks a blob of `huff_table_save(..., HUFF_SERIAL_LSB, ...)` and
+ *        returns its table, which is used in place (not copied).
+ *
+ * Blob must be 32 byte aligned and stay valid while the table is used. Tables
+ * can be decoded with all `huff_decode_lsb*()` decoders, checks make sure no
+ * lookup is out of table even if blob is corrupted.
+ *
+ * @param[in] blob  Blob, e.g. mapped file.
+ * @param[in] size  Bytes available at `blob`.
+ *
+ * @return table in `blob`, `NULL` if blob is invalid.
+ */
+HUFF_INLINE
+const huff_table_t*
+huff_table_load_lsb(const void * __restrict blob, size_t size) {
+  return huff_table_load(blob, size, HUFF_SERIAL_LSB);
+}
+
+/*!
+ * @brief Same as `huff_table_load_lsb()` for MSB-first tables.
+ */
+HUFF_INLINE
+const huff_table_t*
+huff_table_load_msb(const void * __restrict blob, size_t size) {
+  return huff_table_load(blob, size, HUFF_SERIAL_MSB);
+}
+
+/*!
+ * @brief Same as `huff_table_load_lsb()` for blobs of `huff_table_ext_save()`.
+ *
+ * Extras pointer of the table is set to extras in the blob, so the blob must
+ * be writable, e.g. mapped with `MAP_PRIVATE`: only the page of the pointer
+ * is copied, the rest is still shared by processes. Loading the same blob
+ * again doesn't write.
+ *
+ * Extras are checked for `extras[sym - table->offset]` of symbols >= offset,
+ * which both `huff_decode_lsb_ext()` and `huff_decode_lsb_extof()` with
+ * `table->offset` read, so a loaded table can be used with either of them.
+ *
+ * @return table in `blob`, `NULL` if blob is invalid.
+ */
+HUFF_INLINE
+const huff_table_ext_t*
+huff_table_ext_load(void * __restrict blob, size_t size) {
+  huff_table_ext_t   *table;
+  const huff_ext_t   *extras;
+  const uint16_t     *syms;
+  huff_serial_t       hdr;
+  const uint8_t      *p;
+  unsigned            i, fb;
+  int                 x;
+
+  p = huff_serial_check_header(blob, size, HUFF_SERIAL_EXT,
+                               offsetof(huff_table_ext_t, fast),
+                               sizeof(table->fast[0]), &hdr);
+  if (!p)
+    return NULL;
+
+  table  = (huff_table_ext_t *)(void *)((uint8_t *)blob + sizeof(hdr));
+  extras = (const huff_ext_t *)(const void *)(p + hdr.table_size);
+  fb     = table->bits;
+
+  if (!huff_serial_check_table(p + hdr.fast_off, sizeof(table->fast[0]), &hdr,
+                               table->sentinels, table->offsets, table->nfast,
+                               fb, true))
+    return NULL;
+
+  /* shifts by extra bits stay in 32 bits */
+  for (i = 0; i < table->nfast; i++) {
+    if (table->fast[i].bits > 24
+        || table->fast[i].total != table->fast[i].len + table->fast[i].bits)
+      return NULL;
+  }
+
+  /* slow paths of _ext and _extof read extras[sym - offset], sym >= offset */
+  syms = huff_table_syms(table);
+  for (i = 0; i < hdr.nsyms; i++) {
+    x = (int)syms[i] - table->offset;
+    if (x >= (int)hdr.nextras)
+      return NULL;
+  }
+
+  if (table->extras != extras)
+    table->extras = extras;
+
+  return table;
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* huff_serial_h */
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+/*
+ * optional decoder counters, define HUFF_ENABLE_STATS before including huff.h
+ * to enable. counters are per thread, take a snapshot with huff_stats_get().
+ * when disabled counting compiles to nothing and snapshots are zero.
+ */
+
+#ifndef huff_stats_h
+#define huff_stats_h
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <string.h>
+
+/*
+ * codes by length, fast table hits of length l are
+ * codes[l] - sub[l] - slow[l]. sub[0]: sub table lookups which ended in the
+ * slow path, slow[0]: invalid codes.
+ */
+typedef struct huff_stats_t {
+  uint64_t codes[HUFF_MAX_CODE_LENGTH + 1]; /* decoded codes                */
+  uint64_t sub[HUFF_MAX_CODE_LENGTH + 1];   /* resolved by sub tables       */
+  uint64_t slow[HUFF_MAX_CODE_LENGTH + 1];  /* resolved by slow path        */
+  uint64_t refills;                         /* reader refills               */
+  uint64_t bytes;                           /* bytes loaded by refills      */
+} huff_stats_t;
+
+#ifdef HUFF_ENABLE_STATS
+
+/* one definition for all translation units, zero without initializer */
+#if defined(_MSC_VER)
+__declspec(selectany) __declspec(thread) huff_stats_t huff__stats = {{0}};
+#else
+__attribute__((weak)) __thread huff_stats_t huff__stats;
+#endif
+
+#  define HUFF_STAT_CODE(len)   (huff__stats.codes[(len)]++)
+#  define HUFF_STAT_SUB(len)    (huff__stats.sub[(len)]++)
+#  define HUFF_STAT_SLOW(len)   (huff__stats.slow[(len)]++)
+#  define HUFF_STAT_REFILL()    (huff__stats.refills++)
+#  define HUFF_STAT_BYTES(n)    (huff__stats.bytes += (n))
+#else
+#  define HUFF_STAT_CODE(len)   ((void)0)
+#  define HUFF_STAT_SUB(len)    ((void)0)
+#  define HUFF_STAT_SLOW(len)   ((void)0)
+#  define HUFF_STAT_REFILL()    ((void)0)
+#  define HUFF_STAT_BYTES(n)    ((void)0)
+#endif
+
+/*!
+ * @brief Copies counters of the calling thread.
+ */
+HUFF_INLINE
+void
+huff_stats_get(huff_stats_t *stats) {
+#ifdef HUFF_ENABLE_STATS
+  *stats = huff__stats;
+#else
+  memset(stats, 0, sizeof(*stats));
+#endif
+}
+
+/*!
+ * @brief Resets counters of the calling thread.
+ */
+HUFF_INLINE
+void
+huff_stats_reset(void) {
+#ifdef HUFF_ENABLE_STATS
+  memset(&huff__stats, 0, sizeof(huff__stats));
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* huff_stats_h */
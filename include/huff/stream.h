@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef huff_stream_h
+#define huff_stream_h
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * input segment, same layout as POSIX struct iovec so an iovec array can be
+ * passed as it is: (const huff_iovec_t *)iov
+ */
+typedef struct huff_iovec_t {
+  const void *iov_base;
+  size_t      iov_len;
+} huff_iovec_t;
+
+/*!
+ * @brief Continues a reader with the next input segment.
+ *
+ * Bits which are loaded but not consumed yet, e.g. a code split by segment
+ * boundary, stay in the reservoir and continue with the new segment. The
+ * previous segment must be fully loaded (`reader->p == reader->end`), which
+ * is the case when a decoder stopped because input ended.
+ *
+ * @return `false` if the previous segment still has bytes to load.
+ */
+HUFF_INLINE
+bool
+huff_reader_next(huff_reader_t * __restrict reader,
+                 const uint8_t * __restrict buff,
+                 const uint8_t * __restrict end) {
+  if (unlikely(reader->p != reader->end))
+    return false;
+
+  reader->p   = buff;
+  reader->end = end;
+  return true;
+}
+
+/*!
+ * @brief Decodes up to `count` symbols from a chain of input segments.
+ *
+ * The reader and `seg` are the whole decoder state, both can be kept between
+ * calls to suspend and resume at any bit position. Start with a reader
+ * initialized by `huff_reader_init(&reader, NULL, NULL)` and `*seg = 0`.
+ *
+ * @param[in]      table   Pointer to the initialized Huffman table.
+ * @param[in, out] reader  Reader, current segment.
+ * @param[in]      iov     Input segments.
+ * @param[in]      iovcnt  Number of input segments.
+ * @param[in, out] seg     Index of next segment to continue with.
+ * @param[out]     out     Decoded symbols.
+ * @param[in]      count   Max number of symbols to decode.
+ *
+ * @return Number of decoded symbols, less than `count` if all segments are
+ *         used (`*seg == iovcnt`) or an invalid code is found.
+ */
+HUFF_INLINE
+size_t
+huff_decode_lsb_iov(const huff_table_t * __restrict table,
+                    huff_reader_t      * __restrict reader,
+                    const huff_iovec_t * __restrict iov,
+                    size_t                          iovcnt,
+                    size_t             * __restrict seg,
+                    uint16_t           * __restrict out,
+                    size_t                          count) {
+  const uint8_t *base;
+  size_t         n;
+
+  n = 0;
+  for (;;) {
+    n += huff_decode_lsb_n(table, reader, out + n, count - n);
+
+    /* done, or stopped before end of segment: invalid code */
+    if (n == count || reader->p != reader->end || *seg >= iovcnt)
+      break;
+
+    base = (const uint8_t *)iov[*seg].iov_base;
+    huff_reader_next(reader, base, base + iov[*seg].iov_len);
+    (*seg)++;
+  }
+
+  return n;
+}
+
+typedef enum huff_stream_status_t {
+  HUFF_STREAM_NEED_INPUT  = 0, /* all input is consumed                     */
+  HUFF_STREAM_NEED_OUTPUT = 1, /* output is full, call again with the rest  */
+  HUFF_STREAM_ERROR       = 2  /* invalid code                              */
+} huff_stream_status_t;
+
+/*
+ * resumable decoder state for non-blocking I/O, a partial code at the end of
+ * input is kept in bits until next call.
+ */
+typedef struct huff_stream_t {
+  const huff_table_t *table;
+  bitstream_t         bits;    /* pending bits, next bit is LSB             */
+  unsigned            nbits;   /* number of pending bits                    */
+  size_t              in_used; /* bytes consumed by last call               */
+  size_t              out_len; /* symbols written by last call              */
+} huff_stream_t;
+
+HUFF_INLINE
+void
+huff_stream_init(huff_stream_t      * __restrict state,
+                 const huff_table_t * __restrict table) {
+  state->table   = table;
+  state->bits    = 0;
+  state->nbits   = 0;
+  state->in_used = 0;
+  state->out_len = 0;
+}
+
+/*!
+ * @brief Decodes symbols (LSB-first) from a piece of input, can be suspended
+ *        and resumed at any bit position.
+ *
+ * `state->in_used` and `state->out_len` are set to bytes consumed from `in`
+ * and symbols written to `out`. After `HUFF_STREAM_NEED_OUTPUT` continue with
+ * `in + state->in_used`, after `HUFF_STREAM_NEED_INPUT` with next input.
+ * Bits of the last partial code stay in `state->bits` / `state->nbits`, so
+ * at end of message `state->nbits` is the number of trailing padding bits.
+ *
+ * @param[in, out] state    Decoder state initialized by `huff_stream_init()`.
+ * @param[in]      in       Input bytes.
+ * @param[in]      in_len   Number of input bytes.
+ * @param[out]     out      Decoded symbols.
+ * @param[in]      out_cap  Max number of symbols to decode.
+ */
+HUFF_INLINE
+huff_stream_status_t
+huff_decode_stream(huff_stream_t * __restrict state,
+                   const uint8_t * __restrict in,
+                   size_t                     in_len,
+                   uint16_t      * __restrict out,
+                   size_t                     out_cap) {
+  huff_reader_t r;
+  size_t        n;
+
+  r.p     = in;
+  r.end   = in + in_len;
+  r.bits  = state->bits;
+  r.nbits = state->nbits;
+  r.pad   = 0;
+  r.err   = HUFF_OK;
+
+  n = huff_decode_lsb_n(state->table, &r, out, out_cap);
+
+  /* bits above nbits may hold the byte at r.p, it is ORed again at the same
+     position when decoding continues with in + in_used */
+  state->bits    = r.bits;
+  state->nbits   = r.nbits;
+  state->in_used = (size_t)(r.p - in);
+  state->out_len = n;
+
+  if (n == out_cap)
+    return HUFF_STREAM_NEED_OUTPUT;
+
+  /* a code may continue in next input unless there are enough bits */
+  if (r.p == r.end && r.nbits < HUFF_MAX_CODE_LENGTH)
+    return HUFF_STREAM_NEED_INPUT;
+
+  return HUFF_STREAM_ERROR;
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* huff_stream_h */
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * minimal threading wrappers for opt-in headers (cache.h, parallel.h),
+ * pthreads or windows SRW locks / condition variables. not included by huff.h
+ */
+
+#ifndef huff_thread_h
+#define huff_thread_h
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "huff.h"
+
+#if defined(_WIN32)
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  include <windows.h>
+#  include <process.h>
+#  include <malloc.h>
+typedef SRWLOCK            huff_mutex_t;
+typedef CONDITION_VARIABLE huff_cond_t;
+typedef HANDLE             huff_thread_t;
+#  define huff_mutex_init(m)     InitializeSRWLock(m)
+#  define huff_mutex_destroy(m)  (void)(m)
+#  define huff_mutex_lock(m)     AcquireSRWLockExclusive(m)
+#  define huff_mutex_unlock(m)   ReleaseSRWLockExclusive(m)
+#  define huff_cond_init(c)      InitializeConditionVariable(c)
+#  define huff_cond_destroy(c)   (void)(c)
+#  define huff_cond_wait(c, m)   SleepConditionVariableSRW(c, m, INFINITE, 0)
+#  define huff_cond_signal(c)    WakeConditionVariable(c)
+#  define huff_cond_broadcast(c) WakeAllConditionVariable(c)
+#else
+#  include <pthread.h>
+typedef pthread_mutex_t    huff_mutex_t;
+typedef pthread_cond_t     huff_cond_t;
+typedef pthread_t          huff_thread_t;
+#  define huff_mutex_init(m)     pthread_mutex_init(m, NULL)
+#  define huff_mutex_destroy(m)  pthread_mutex_destroy(m)
+#  define huff_mutex_lock(m)     pthread_mutex_lock(m)
+#  define huff_mutex_unlock(m)   pthread_mutex_unlock(m)
+#  define huff_cond_init(c)      pthread_cond_init(c, NULL)
+#  define huff_cond_destroy(c)   pthread_cond_destroy(c)
+#  define huff_cond_wait(c, m)   pthread_cond_wait(c, m)
+#  define huff_cond_signal(c)    pthread_cond_signal(c)
+#  define huff_cond_broadcast(c) pthread_cond_broadcast(c)
+#endif
+
+typedef void (*huff_thread_fn)(void *arg);
+
+typedef struct huff_thread_start_t {
+  huff_thread_fn fn;
+  void          *arg;
+} huff_thread_start_t;
+
+#if defined(_WIN32)
+static inline unsigned __stdcall
+huff_thread_main(void *arg) {
+  huff_thread_start_t start;
+
+  start = *(huff_thread_start_t *)arg;
+  free(arg);
+  start.fn(start.arg);
+  return 0;
+}
+#else
+static inline void*
+huff_thread_main(void *arg) {
+  huff_thread_start_t start;
+
+  start = *(huff_thread_start_t *)arg;
+  free(arg);
+  start.fn(start.arg);
+  return NULL;
+}
+#endif
+
+/*!
+ * @brief Starts a thread which runs `fn(arg)`.
+ *
+ * @return `false` if the thread couldn't be created.
+ */
+HUFF_INLINE
+bool
+huff_thread_create(huff_thread_t *thread, huff_thread_fn fn, void *arg) {
+  huff_thread_start_t *start;
+
+  if (!(start = (huff_thread_start_t *)malloc(sizeof(*start))))
+    return false;
+
+  start->fn  = fn;
+  start->arg = arg;
+
+#if defined(_WIN32)
+  *thread = (HANDLE)_beginthreadex(NULL, 0, huff_thread_main, start, 0, NULL);
+  if (*thread)
+    return true;
+#else
+  if (pthread_create(thread, NULL, huff_thread_main, start) == 0)
+    return true;
+#endif
+
+  free(start);
+  return false;
+}
+
+HUFF_INLINE
+void
+huff_thread_join(huff_thread_t thread) {
+#if defined(_WIN32)
+  WaitForSingleObject(thread, INFINITE);
+  CloseHandle(thread);
+#else
+  pthread_join(thread, NULL);
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* huff_thread_h */
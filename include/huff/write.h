@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef huff_write_h
+#define huff_write_h
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <string.h>
+
+/*
+ * buffered bit writer, codes are collected in bits and stored with a single
+ * 8 byte store per flush. up to 56 bits can be put between flushes. bits are
+ * 64-bit even with HUFF_ENABLE_BIG_BITSTREAM, a wider store doesn't pay off.
+ */
+typedef struct huff_writer_t {
+  uint8_t    *p;     /* next byte to store                                  */
+  uint8_t    *end;   /* end of output                                       */
+  uint64_t    bits;  /* pending bits                                        */
+  unsigned    nbits; /* number of pending bits                              */
+} huff_writer_t;
+
+HUFF_INLINE
+void
+huff_store64le(uint8_t * __restrict p, uint64_t v) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  v = __builtin_bswap64(v);
+#endif
+  memcpy(p, &v, sizeof(v));
+}
+
+HUFF_INLINE
+void
+huff_store64be(uint8_t * __restrict p, uint64_t v) {
+#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#  if defined(_MSC_VER) && !defined(__clang__)
+  v = _byteswap_uint64(v);
+#  else
+  v = __builtin_bswap64(v);
+#  endif
+#endif
+  memcpy(p, &v, sizeof(v));
+}
+
+HUFF_INLINE
+void
+huff_writer_init(huff_writer_t * __restrict writer,
+                 uint8_t       * __restrict buff,
+                 uint8_t       * __restrict end) {
+  writer->p     = buff;
+  writer->end   = end;
+  writer->bits  = 0;
+  writer->nbits = 0;
+}
+
+/*!
+ * @brief Appends a code to an LSB-first stream, code must be bit-reversed
+ *        e.g. by `huff_codes_lsb()`.
+ */
+HUFF_INLINE
+void
+huff_writer_put_lsb(huff_writer_t * __restrict writer,
+                    uint32_t                   code,
+                    unsigned                   len) {
+  writer->bits  |= (uint64_t)code << writer->nbits;
+  writer->nbits += len;
+}
+
+/*!
+ * @brief Stores complete bytes of an LSB-first stream, at most 7 bits stay.
+ *
+ * @return `false` if output is full.
+ */
+HUFF_INLINE
+bool
+huff_writer_flush_lsb(huff_writer_t * __restrict writer) {
+  if (likely(writer->end - writer->p >= 8)) {
+    huff_store64le(writer->p, writer->bits);
+    writer->p     += writer->nbits >> 3;
+    writer->bits >>= writer->nbits & ~7U;
+    writer->nbits &= 7;
+    return true;
+  }
+
+  while (writer->nbits >= 8) {
+    if (unlikely(writer->p >= writer->end))
+      return false;
+
+    *writer->p++    = (uint8_t)writer->bits;
+    writer->bits  >>= 8;
+    writer->nbits  -= 8;
+  }
+
+  return true;
+}
+
+/*!
+ * @brief Flushes and stores the last partial byte (zero padded).
+ *
+ * @return `false` if output is full.
+ */
+HUFF_INLINE
+bool
+huff_writer_finish_lsb(huff_writer_t * __restrict writer) {
+  if (!huff_writer_flush_lsb(writer))
+    return false;
+
+  if (writer->nbits) {
+    if (unlikely(writer->p >= writer->end))
+      return false;
+
+    *writer->p++  = (uint8_t)writer->bits;
+    writer->bits  = 0;
+    writer->nbits = 0;
+  }
+
+  return true;
+}
+
+/*!
+ * @brief Appends a code to an MSB-first stream e.g. by `huff_codes_msb()`.
+ */
+HUFF_INLINE
+void
+huff_writer_put_msb(huff_writer_t * __restrict writer,
+                    uint32_t                   code,
+                    unsigned                   len) {
+  writer->bits   = (writer->bits << len) | code;
+  writer->nbits += len;
+}
+
+/*!
+ * @brief Stores complete bytes of an MSB-first stream, at most 7 bits stay.
+ *
+ * @return `false` if output is full.
+ */
+HUFF_INLINE
+bool
+huff_writer_flush_msb(huff_writer_t * __restrict writer) {
+  uint64_t left;
+
+  /* left-align pending bits, two shifts avoid shifting by 64 */
+  left = (writer->bits << (63 - writer->nbits)) << 1;
+
+  if (likely(writer->end - writer->p >= 8)) {
+    huff_store64be(writer->p, left);
+    writer->p     += writer->nbits >> 3;
+    writer->nbits &= 7;
+    return true;
+  }
+
+  while (writer->nbits >= 8) {
+    if (unlikely(writer->p >= writer->end))
+      return false;
+
+    *writer->p++   = (uint8_t)(left >> 56);
+    left         <<= 8;
+    writer->nbits -= 8;
+  }
+
+  return true;
+}
+
+/*!
+ * @brief Flushes and stores the last partial byte (zero padded).
+ *
+ * @return `false` if output is full.
+ */
+HUFF_INLINE
+bool
+huff_writer_finish_msb(huff_writer_t * __restrict writer) {
+  if (!huff_writer_flush_msb(writer))
+    return false;
+
+  if (writer->nbits) {
+    if (unlikely(writer->p >= writer->end))
+      return false;
+
+    *writer->p++  = (uint8_t)(writer->bits << (8 - writer->nbits));
+    writer->bits  = 0;
+    writer->nbits = 0;
+  }
+
+  return true;
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* huff_write_h */
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * prints constant fixed Huffman tables of include/huff/deflate.h, tables are
+ * built by huff_init_lsb_extof_bits() so they are exactly what it would build:
+ *
+ *   cc -Iinclude scripts/deflate_table.c -o deflate_table && ./deflate_table
+ */
+
+#define HUFF_DEFLATE_GEN
+#include <huff/deflate.h>
+#include <stdio.h>
+
+static void
+print_u16(const char *name, const uint16_t *v, int n) {
+  int i;
+
+  /* zero tail is left to the initializer */
+  while (n > 1 && !v[n - 1])
+    n--;
+
+  /* positional, designated initializers need C++20 */
+  printf("  /* %s */\n  {{", name);
+  for (i = 0; i < n; i++)
+    printf("%s%s%u", i ? "," : "", i % 12 ? "" : "\n    ", v[i]);
+  printf("\n  }},\n");
+}
+
+/* symbols are stored after fast entries, they are left out if unreachable */
+static int
+syms_unused(const huff_table_ext_t *t) {
+  static huff_table_ext_t c;
+  unsigned                w, v1, v2;
+  uint8_t                 u1, u2;
+  uint_fast16_t           s1, s2;
+
+  c = *t;
+  memset((void *)huff_table_syms(&c), 0, HUFF_MAX_CODES * sizeof(uint16_t));
+
+  for (w = 0; w < (1U << HUFF_MAX_CODE_LENGTH); w++) {
+    s1 = huff_decode_lsb_extof(t,  w, &u1, &v1, t->offset);
+    s2 = huff_decode_lsb_extof(&c, w, &u2, &v2, t->offset);
+    if (s1 != s2 || u1 != u2 || (u1 && v1 != v2))
+      return 0;
+  }
+
+  return 1;
+}
+
+static void
+print_table(const char *name, const huff_table_ext_t *t, const char *extras) {
+  const huff_fast_entry_ext_t *e;
+  char                         v[64];
+  int                          i;
+
+  if (!syms_unused(t)) {
+    fprintf(stderr, "%s: symbols are used by slow path\n", name);
+    exit(1);
+  }
+
+  printf("static const huff_table_ext_t %s = {\n", name);
+
+  print_u16("sentinels", t->sentinels, HUFF_MAX_CODE_LENGTH + 1);
+  print_u16("offsets",   t->offsets,   HUFF_MAX_CODE_LENGTH + 1);
+
+  snprintf(v, sizeof(v), "%s,", extras);
+  printf("  %-26s/* extras */\n", v);
+  snprintf(v, sizeof(v), "%d,", t->offset);
+  printf("  %-26s/* offset */\n", v);
+  snprintf(v, sizeof(v), "%u,", t->nfast);
+  printf("  %-26s/* nfast  */\n", v);
+  snprintf(v, sizeof(v), "%u,", t->bits);
+  printf("  %-26s/* bits   */\n", v);
+
+  printf("  /* fast */\n  {");
+  for (i = 0; i < t->nfast; i++) {
+    e = &t->fast[i];
+    printf("%s%s{%u,%u,%u,%u,%u,%u}", i ? "," : "", i % 5 ? "" : "\n    ",
+           e->len, e->sub, e->sym, e->base, e->bits, e->total);
+  }
+  printf("\n  }\n");
+  printf("};\n\n");
+}
+
+int
+main(void) {
+  static huff_table_ext_t litlen, dist;
+  uint8_t                 lengths[HUFF_DEFLATE_FIXED_LITLEN];
+  int                     i;
+
+  for (i = 0;   i < 144; i++) lengths[i] = 8;
+  for (i = 144; i < 256; i++) lengths[i] = 9;
+  for (i = 256; i < 280; i++) lengths[i] = 7;
+  for (i = 280; i < 288; i++) lengths[i] = 8;
+
+  if (!huff_init_lsb_extof_bits(&litlen, lengths, NULL, huff_deflate_len_extras,
+                                HUFF_DEFLATE_LITLEN_OFFSET,
+                                HUFF_DEFLATE_FIXED_LITLEN, 9))
+    return 1;
+
+  for (i = 0; i < HUFF_DEFLATE_FIXED_DIST; i++) lengths[i] = 5;
+
+  if (!huff_init_lsb_extof_bits(&dist, lengths, NULL, huff_deflate_dist_extras,
+                                0, HUFF_DEFLATE_FIXED_DIST, 5))
+    return 1;
+
+  print_table("huff_deflate_fixed_litlen", &litlen, "huff_deflate_len_extras");
+  print_table("huff_deflate_fixed_dist",   &dist,   "huff_deflate_dist_extras");
+
+  return 0;
+}
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2024 Recep Aslantas
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# generates constant tables of include/huff/hpack.h from code lengths of
+# RFC 7541 Appendix B, the code is canonical so lengths are enough:
+#
+#   python3 scripts/hpack_table.py > tables.txt
+
+FAST_BITS = 11
+
+LENGTHS = [
+  13, 23, 28, 28, 28, 28, 28, 28, 28, 24, 30, 28, 28, 30, 28, 28,  #   0
+  28, 28, 28, 28, 28, 28, 30, 28, 28, 28, 28, 28, 28, 28, 28, 28,  #  16
+   6, 10, 10, 12, 13,  6,  8, 11, 10, 10,  8, 11,  8,  6,  6,  6,  #  32
+   5,  5,  5,  6,  6,  6,  6,  6,  6,  6,  7,  8, 15,  6, 12, 10,  #  48
+  13,  6,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  #  64
+   7,  7,  7,  7,  7,  7,  7,  7,  8,  7,  8, 13, 19, 13, 14,  6,  #  80
+  15,  5,  6,  5,  6,  5,  6,  6,  6,  5,  7,  7,  6,  6,  6,  5,  #  96
+   6,  7,  6,  5,  5,  6,  7,  7,  7,  7,  7, 15, 11, 14, 13, 28,  # 112
+  20, 22, 20, 20, 22, 22, 22, 23, 22, 23, 23, 23, 23, 23, 24, 23,  # 128
+  24, 24, 22, 23, 24, 23, 23, 23, 23, 21, 22, 23, 22, 23, 23, 24,  # 144
+  22, 21, 20, 22, 22, 23, 23, 21, 23, 22, 22, 24, 21, 22, 23, 23,  # 160
+  21, 21, 22, 21, 23, 22, 23, 23, 20, 22, 22, 22, 23, 22, 22, 23,  # 176
+  26, 26, 20, 19, 22, 23, 22, 25, 26, 26, 26, 27, 27, 26, 24, 25,  # 192
+  19, 21, 26, 27, 27, 26, 27, 24, 21, 21, 26, 26, 28, 27, 27, 27,  # 208
+  20, 24, 20, 21, 22, 21, 21, 23, 22, 22, 25, 25, 24, 24, 26, 23,  # 224
+  26, 27, 26, 26, 27, 27, 27, 27, 27, 28, 27, 27, 27, 27, 27, 26,  # 240
+  30                                                               # EOS
+]
+
+def canonical(lengths):
+  codes, code, prev = [0] * len(lengths), 0, 0
+  for s in sorted(range(len(lengths)), key=lambda s: (lengths[s], s)):
+    code <<= lengths[s] - prev
+    prev     = lengths[s]
+    codes[s] = code
+    code    += 1
+  return codes
+
+def rows(items, per_line, indent="  "):
+  out = []
+  for i in range(0, len(items), per_line):
+    out.append(indent + ",".join(items[i:i + per_line]) + ",")
+  out[-1] = out[-1][:-1]
+  return "\n".join(out)
+
+def main():
+  L, C = LENGTHS, canonical(LENGTHS)
+  assert sum(2 ** (30 - l) for l in L) == 2 ** 30  # complete
+
+  # (code, length) -> symbol for codes up to FAST_BITS
+  short = {(C[s], L[s]): s for s in range(256) if L[s] <= FAST_BITS}
+
+  def first(v, bits):
+    for l in range(1, bits + 1):
+      s = short.get((v >> (bits - l), l))
+      if s is not None:
+        return s, l
+    return None, 0
+
+  fast = []
+  for i in range(1 << FAST_BITS):
+    s1, l1 = first(i, FAST_BITS)
+    if s1 is None:
+      fast.append("{ 0, 0,{  0,  0}}")
+      continue
+    rest = FAST_BITS - l1
+    s2, l2 = first(i & ((1 << rest) - 1), rest) if rest else (None, 0)
+    if s2 is None:
+      fast.append("{%2d,%2d,{%3d,  0}}" % (l1, l1, s1))
+    else:
+      fast.append("{%2d,%2d,{%3d,%3d}}" % (l1, l1 + l2, s1, s2))
+
+  # slow path: left-aligned 32-bit limits and symbol offsets per length
+  syms   = sorted(range(257), key=lambda s: (L[s], s))
+  limit  = [0] * 31
+  offset = [0] * 31
+  idx    = 0
+  for l in range(1, 31):
+    n = [s for s in syms if L[s] == l]
+    if n:
+      offset[l] = idx - C[n[0]]
+      limit[l]  = (C[n[-1]] + 1) << (32 - l)
+    else:
+      limit[l]  = limit[l - 1] if l > 1 else 0
+      offset[l] = 0
+    idx += len(n)
+
+  print("static const uint32_t huff_hpack_codes[HUFF_HPACK_SYMS] = {")
+  print(rows(["0x%08x" % c for c in C], 8))
+  print("};\n")
+  print("static const uint8_t huff_hpack_lengths[HUFF_HPACK_SYMS] = {")
+  print(rows(["%2d" % l for l in L], 16))
+  print("};\n")
+  print("static const huff_hpack_entry_t huff_hpack_fast[1 << HUFF_HPACK_FAST_BITS] = {")
+  print(rows(fast, 5))
+  print("};\n")
+  print("static const uint64_t huff_hpack_limit[HUFF_HPACK_MAX_LENGTH + 1] = {")
+  print(rows(["0x%09x" % v for v in limit], 6))
+  print("};\n")
+  print("static const int32_t huff_hpack_offset[HUFF_HPACK_MAX_LENGTH + 1] = {")
+  print(rows(["%d" % v for v in offset], 8))
+  print("};\n")
+  print("static const uint16_t huff_hpack_syms[HUFF_HPACK_SYMS] = {")
+  print(rows(["%3d" % s for s in syms], 16))
+  print("};")
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <huff/call.h>
+#include "impl.h"
+
+/*
+ * resolved on first use, resolution always gives the same table so a race
+ * between threads only repeats the cpuid
+ */
+static const huff_impl_t * volatile huff__impl;
+
+/* impl_avx2.c is compiled with -mavx2 -mbmi -mbmi2 -mlzcnt, require all */
+#define HUFF_IMPL_AVX2_FEATURES                                               \
+  (HUFF_CPU_AVX2 | HUFF_CPU_BMI1 | HUFF_CPU_BMI2 | HUFF_CPU_LZCNT)
+
+static const huff_impl_t *
+huff_impl_resolve(void) {
+  const huff_impl_t *impl;
+  unsigned           f;
+
+  f    = huff_cpu_features();
+  impl = &huff_impl_base;
+
+#ifdef HUFF_HAVE_AVX2_IMPL
+  if ((f & HUFF_IMPL_AVX2_FEATURES) == HUFF_IMPL_AVX2_FEATURES)
+    impl = &huff_impl_avx2;
+#endif
+
+  (void)f;
+  return impl;
+}
+
+static inline
+const huff_impl_t *
+huff_impl(void) {
+  const huff_impl_t *impl;
+
+  if (unlikely(!(impl = huff__impl)))
+    huff__impl = impl = huff_impl_resolve();
+
+  return impl;
+}
+
+HUFF_EXPORT
+const char*
+huffc_impl_name(void) {
+  return huff_impl()->name;
+}
+
+HUFF_EXPORT
+int
+huffc_read(const uint8_t ** __restrict buff,
+           bitstream_t    * __restrict bits,
+           const uint8_t  * __restrict end) {
+  return huff_impl()->read(buff, bits, end);
+}
+
+HUFF_EXPORT
+bool
+huffc_init_lsb_bits(huff_table_t   * __restrict table,
+                    const uint8_t  * __restrict lengths,
+                    const uint16_t * __restrict symbols,
+                    uint16_t                    n,
+                    uint8_t                     fast_bits) {
+  return huff_impl()->init_lsb_bits(table, lengths, symbols, n, fast_bits);
+}
+
+HUFF_EXPORT
+bool
+huffc_init_msb_bits(huff_table_t   * __restrict table,
+                    const uint8_t  * __restrict lengths,
+                    const uint16_t * __restrict symbols,
+                    uint16_t                    n,
+                    uint8_t                     fast_bits) {
+  return huff_impl()->init_msb_bits(table, lengths, symbols, n, fast_bits);
+}
+
+HUFF_EXPORT
+bool
+huffc_init_lsb_extof_bits(huff_table_ext_t   * __restrict table,
+                          const uint8_t      * __restrict lengths,
+                          const uint16_t     * __restrict symbols,
+                          const huff_ext_t   * __restrict extras,
+                          int                             offset,
+                          uint16_t                        n,
+                          uint8_t                         fast_bits) {
+  return huff_impl()->init_lsb_extof_bits(table, lengths, symbols, extras,
+                                          offset, n, fast_bits);
+}
+
+HUFF_EXPORT
+size_t
+huffc_decode_lsb_n(const huff_table_t * __restrict table,
+                   huff_reader_t      * __restrict reader,
+                   uint16_t           * __restrict out,
+                   size_t                          count) {
+  return huff_impl()->decode_lsb_n(table, reader, out, count);
+}
+
+HUFF_EXPORT
+size_t
+huffc_decode_lsb_multi_n(const huff_table_multi_t * __restrict table,
+                         huff_reader_t            * __restrict reader,
+                         uint16_t                 * __restrict out,
+                         size_t                                count) {
+  return huff_impl()->decode_lsb_multi_n(table, reader, out, count);
+}
+
+HUFF_EXPORT
+bool
+huffc_decode_lsb_streams(const huff_table_t * __restrict table,
+                         huff_reader_t      * __restrict readers,
+                         uint16_t          ** __restrict out,
+                         size_t             * __restrict counts,
+                         unsigned                        nstreams) {
+  return huff_impl()->decode_lsb_streams(table, readers, out, counts, nstreams);
+}
+
+HUFF_EXPORT
+bool
+huffc_decode_lsb_batch(huff_record_t * __restrict recs, size_t n) {
+  return huff_impl()->decode_lsb_batch(recs, n);
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * one implementation of huffc functions, included by impl_*.c which are
+ * compiled with different target flags. HUFF_IMPL_SUFFIX names the variant.
+ */
+
+#ifndef huff_src_impl_h
+#define huff_src_impl_h
+
+#include <huff/huff.h>
+
+typedef struct huff_impl_t {
+  const char *name;
+  int    (*read)(const uint8_t **, bitstream_t *, const uint8_t *);
+  bool   (*init_lsb_bits)(huff_table_t *, const uint8_t *, const uint16_t *,
+                          uint16_t, uint8_t);
+  bool   (*init_msb_bits)(huff_table_t *, const uint8_t *, const uint16_t *,
+                          uint16_t, uint8_t);
+  bool   (*init_lsb_extof_bits)(huff_table_ext_t *, const uint8_t *,
+                                const uint16_t *, const huff_ext_t *, int,
+                                uint16_t, uint8_t);
+  size_t (*decode_lsb_n)(const huff_table_t *, huff_reader_t *, uint16_t *,
+                         size_t);
+  size_t (*decode_lsb_multi_n)(const huff_table_multi_t *, huff_reader_t *,
+                               uint16_t *, size_t);
+  bool   (*decode_lsb_streams)(const huff_table_t *, huff_reader_t *,
+                               uint16_t **, size_t *, unsigned);
+  bool   (*decode_lsb_batch)(huff_record_t *, size_t);
+} huff_impl_t;
+
+extern const huff_impl_t huff_impl_base;
+#ifdef HUFF_HAVE_AVX2_IMPL
+extern const huff_impl_t huff_impl_avx2;
+#endif
+
+#endif /* huff_src_impl_h */
+
+#ifdef HUFF_IMPL_SUFFIX
+
+#define HUFF_IMPL_CAT_(a, b) a##_##b
+#define HUFF_IMPL_CAT(a, b)  HUFF_IMPL_CAT_(a, b)
+#define HUFF_IMPL(name)      HUFF_IMPL_CAT(huff_impl_##name, HUFF_IMPL_SUFFIX)
+#define HUFF_IMPL_STR_(x)    #x
+#define HUFF_IMPL_STR(x)     HUFF_IMPL_STR_(x)
+
+static int
+HUFF_IMPL(read)(const uint8_t **buff, bitstream_t *bits, const uint8_t *end) {
+  return huff_read(buff, bits, end);
+}
+
+static bool
+HUFF_IMPL(init_lsb_bits)(huff_table_t   *table,
+                         const uint8_t  *lengths,
+                         const uint16_t *symbols,
+                         uint16_t        n,
+                         uint8_t         fast_bits) {
+  return huff_init_lsb_bits(table, lengths, symbols, n, fast_bits);
+}
+
+static bool
+HUFF_IMPL(init_msb_bits)(huff_table_t   *table,
+                         const uint8_t  *lengths,
+                         const uint16_t *symbols,
+                         uint16_t        n,
+                         uint8_t         fast_bits) {
+  return huff_init_msb_bits(table, lengths, symbols, n, fast_bits);
+}
+
+static bool
+HUFF_IMPL(init_lsb_extof_bits)(huff_table_ext_t *table,
+                               const uint8_t    *lengths,
+                               const uint16_t   *symbols,
+                               const huff_ext_t *extras,
+                               int               offset,
+                               uint16_t          n,
+                               uint8_t           fast_bits) {
+  return huff_init_lsb_extof_bits(table, lengths, symbols, extras, offset, n,
+                                  fast_bits);
+}
+
+static size_t
+HUFF_IMPL(decode_lsb_n)(const huff_table_t *table,
+                        huff_reader_t      *reader,
+                        uint16_t           *out,
+                        size_t              count) {
+  return huff_decode_lsb_n(table, reader, out, count);
+}
+
+static size_t
+HUFF_IMPL(decode_lsb_multi_n)(const huff_table_multi_t *table,
+                              huff_reader_t            *reader,
+                              uint16_t                 *out,
+                              size_t                    count) {
+  return huff_decode_lsb_multi_n(table, reader, out, count);
+}
+
+static bool
+HUFF_IMPL(decode_lsb_streams)(const huff_table_t *table,
+                              huff_reader_t      *readers,
+                              uint16_t          **out,
+                              size_t             *counts,
+                              unsigned            nstreams) {
+  return huff_decode_lsb_streams(table, readers, out, counts, nstreams);
+}
+
+static bool
+HUFF_IMPL(decode_lsb_batch)(huff_record_t *recs, size_t n) {
+  return huff_decode_lsb_batch(recs, n);
+}
+
+const huff_impl_t HUFF_IMPL_CAT(huff_impl, HUFF_IMPL_SUFFIX) = {
+  HUFF_IMPL_STR(HUFF_IMPL_SUFFIX),
+  HUFF_IMPL(read),
+  HUFF_IMPL(init_lsb_bits),
+  HUFF_IMPL(init_msb_bits),
+  HUFF_IMPL(init_lsb_extof_bits),
+  HUFF_IMPL(decode_lsb_n),
+  HUFF_IMPL(decode_lsb_multi_n),
+  HUFF_IMPL(decode_lsb_streams),
+  HUFF_IMPL(decode_lsb_batch)
+};
+
+#endif /* HUFF_IMPL_SUFFIX */
@@ -0,0 +1,24 @@
+/*
+ * Copyright (C) 2024 Recep Aslantas
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * compiled with AVX2 + BMI1 / BMI2 + LZCNT (see CMakeLists.txt) and only used
+ * if the cpu has all of them: AVX2 table fills and huff_read_avx2(), bzhi /
+ * shrx for bit extraction and variable shifts
+ */
+#define HUFF_IMPL_SUFFIX avx2
+#include "impl.h"